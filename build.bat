@@ -27,12 +27,14 @@ git archive origin/upstream | tar -xf - -C "%BUILD_DIR%"
 
 :: Layer 2: overlay files from current branch (overwrites upstream where needed)
 echo Applying overlay files...
-git archive HEAD -- src/ include/ test/ platformio.ini | tar -xf - -C "%BUILD_DIR%"
+git archive HEAD -- src/ include/ test/ content/ platformio.ini min_spiffs_imgstore.csv | tar -xf - -C "%BUILD_DIR%"
 
 echo.
 echo Build directory ready: %BUILD_DIR%
 echo.
 echo   Build:   cd %BUILD_DIR% ^&^& pio run -e github_pages
 echo   Test:    cd %BUILD_DIR% ^&^& pio test -e native-crypto
+echo   Budgets: cd %BUILD_DIR% ^&^& pio test -e native-budget
+echo   G5:      cd %BUILD_DIR% ^&^& pio test -e native-g5
 echo   Flash:   cd %BUILD_DIR% ^&^& pio run -e github_pages -t upload
 echo   Clean:   rmdir /s /q %BUILD_DIR%
@@ -24,16 +24,20 @@ git archive origin/upstream | tar -x -C "$BUILD_DIR"
 
 # Layer 2: overlay files from current branch (overwrites upstream where needed)
 echo "Applying overlay files..."
-# git archive HEAD -- src/ include/ test/ platformio.ini | tar -x -C "$BUILD_DIR"
+# git archive HEAD -- src/ include/ test/ content/ platformio.ini min_spiffs_imgstore.csv | tar -x -C "$BUILD_DIR"
 cp -rf src/ "$BUILD_DIR"/src/
 cp -rf include/ "$BUILD_DIR"/include/
 cp -rf test/ "$BUILD_DIR"/test
+cp -rf content/ "$BUILD_DIR"/content
 cp -f platformio.ini "$BUILD_DIR"/platformio.ini
+cp -f min_spiffs_imgstore.csv "$BUILD_DIR"/min_spiffs_imgstore.csv
 
 echo ""
 echo "Build directory ready: $BUILD_DIR"
 echo ""
 echo "  Build:   cd $BUILD_DIR && pio run -e github_pages"
 echo "  Test:    cd $BUILD_DIR && pio test -e native-crypto"
+echo "  Budgets: cd $BUILD_DIR && pio test -e native-budget"
+echo "  G5:      cd $BUILD_DIR && pio test -e native-g5"
 echo "  Flash:   cd $BUILD_DIR && pio run -e github_pages -t upload"
 echo "  Clean:   rm -rf $BUILD_DIR"
@@ -0,0 +1,46 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstdint>
+#include <cstddef>
+
+// Bump allocator over one block reserved at the start of a wake. Nothing is
+// freed individually: stages take a mark and rewind to it when their scratch
+// is dead, and the whole block goes back to the heap before deep sleep.
+#define ARENA_ALIGN 16
+
+struct Arena
+{
+    uint8_t *base;
+    size_t capacity;
+    size_t used;
+    size_t high_water;
+    size_t allocs;  // allocations handed out
+    size_t failed;  // allocations refused for lack of space
+};
+
+/**
+ * @brief Set up an arena over a caller-owned block
+ * @param a Arena state
+ * @param buffer Backing memory (nullptr gives an arena that refuses everything)
+ * @param capacity Size of buffer
+ */
+void arena_init(Arena &a, void *buffer, size_t capacity);
+
+/**
+ * @brief Allocate ARENA_ALIGN-aligned memory
+ * @return Pointer into the arena, or nullptr if it doesn't fit
+ */
+void *arena_alloc(Arena &a, size_t size);
+
+/**
+ * @brief Current fill level, for arena_rewind()
+ */
+size_t arena_mark(const Arena &a);
+
+/**
+ * @brief Drop everything allocated since mark
+ */
+void arena_rewind(Arena &a, size_t mark);
+
+#endif
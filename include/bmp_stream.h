@@ -0,0 +1,49 @@
+#ifndef BMP_STREAM_H
+#define BMP_STREAM_H
+
+#include <cstdint>
+#include <cstddef>
+
+// Header + palette must fit here; 1-bpp files are 62 bytes (14 + 40 + 2 x 4)
+#define BMP_STREAM_HEADER_MAX 128
+
+// Writes an uncompressed 1-bpp BMP, fed in arbitrary chunks, straight into a
+// top-down packed framebuffer (MSB = leftmost pixel). Bottom-up files are
+// flipped as rows arrive; no copy of the file is kept beyond its header.
+struct BmpStream
+{
+    uint8_t header[BMP_STREAM_HEADER_MAX];  // raw header, for parseBMPHeader()
+    size_t pos;                             // file offset of the next byte
+    bool header_done;
+    bool failed;
+    uint32_t file_size;                     // from the BMP file header
+    uint32_t pixel_offset;
+    uint32_t stride;                        // BMP row length incl. padding
+    bool bottom_up;
+    uint8_t *framebuffer;
+    uint16_t width;
+    uint16_t height;
+    size_t rows_written;
+};
+
+/**
+ * @brief Start decoding into a framebuffer
+ * @param s Stream state
+ * @param framebuffer width/8 x height bytes
+ * @param width Panel width in pixels (multiple of 8); the BMP must match
+ * @param height Panel height in pixels; the BMP must match
+ */
+void bmp_stream_begin(BmpStream &s, uint8_t *framebuffer, uint16_t width, uint16_t height);
+
+/**
+ * @brief Feed the next bytes of the file
+ * @return false once the header is invalid or the data runs past the pixel array
+ */
+bool bmp_stream_write(BmpStream &s, const uint8_t *data, size_t len);
+
+/**
+ * @brief Whether every pixel row has been written
+ */
+bool bmp_stream_complete(const BmpStream &s);
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include "mbedtls/aes.h"
 
 #define AES256_KEY_SIZE 32
 #define AES_BLOCK_SIZE 16
@@ -20,6 +21,137 @@
 bool aes256_cbc_decrypt(const uint8_t *key, const uint8_t *input, size_t input_len,
                         uint8_t *output, size_t *output_len);
 
+/**
+ * @brief Encrypt with AES-256-CBC and PKCS7 padding (host tools and tests)
+ * @param key 32-byte AES key
+ * @param iv 16-byte IV, written in front of the ciphertext
+ * @param input Plaintext
+ * @param input_len Plaintext length
+ * @param output Output buffer: [IV][ciphertext], at least aes256_cbc_encrypted_size(input_len) bytes
+ * @param output_len Pointer to store the output length
+ * @return true on success, false on error
+ */
+bool aes256_cbc_encrypt(const uint8_t *key, const uint8_t *iv, const uint8_t *input, size_t input_len,
+                        uint8_t *output, size_t *output_len);
+
+/**
+ * @brief Size of aes256_cbc_encrypt() output for a plaintext length
+ */
+size_t aes256_cbc_encrypted_size(size_t input_len);
+
+/**
+ * @brief Receives decrypted plaintext from the streaming decryptor
+ * @param data Plaintext bytes
+ * @param len Number of bytes
+ * @param ctx Caller context
+ * @return false to abort decryption
+ */
+typedef bool (*crypto_sink_fn)(const uint8_t *data, size_t len, void *ctx);
+
+// Streaming AES-256-CBC decryption of the same [IV][ciphertext] layout as
+// aes256_cbc_decrypt(). The last plaintext block is held back until
+// aes256_cbc_stream_finish() so PKCS7 padding never reaches the sink.
+struct Aes256CbcStream
+{
+    mbedtls_aes_context aes;
+    uint8_t iv[AES_IV_SIZE];
+    uint8_t partial[AES_BLOCK_SIZE];  // IV or ciphertext block still being filled
+    size_t partial_len;
+    bool have_iv;
+    uint8_t held[AES_BLOCK_SIZE];     // last decrypted block, may hold padding
+    bool have_held;
+    bool failed;
+};
+
+/**
+ * @brief Start a streaming decryption
+ * @param s Stream state
+ * @param key 32-byte AES key
+ * @return true on success
+ */
+bool aes256_cbc_stream_begin(Aes256CbcStream &s, const uint8_t *key);
+
+/**
+ * @brief Feed ciphertext (IV first) in chunks of any size
+ * @param s Stream state
+ * @param input Next ciphertext bytes
+ * @param len Number of bytes
+ * @param sink Receives plaintext as whole blocks become available
+ * @param ctx Passed to sink
+ * @return false if the sink aborted or the stream already failed
+ */
+bool aes256_cbc_stream_update(Aes256CbcStream &s, const uint8_t *input, size_t len,
+                              crypto_sink_fn sink, void *ctx);
+
+/**
+ * @brief Check padding, emit the final plaintext bytes and release the stream
+ * @param s Stream state
+ * @param sink Receives the unpadded last block
+ * @param ctx Passed to sink
+ * @return true if the whole stream was valid
+ */
+bool aes256_cbc_stream_finish(Aes256CbcStream &s, crypto_sink_fn sink, void *ctx);
+
+/**
+ * @brief Release a stream without finishing it (error paths)
+ */
+void aes256_cbc_stream_abort(Aes256CbcStream &s);
+
+// Random-access reads of plaintext from [IV][ciphertext] kept outside RAM
+// (e.g. a file in flash). Any CBC block decrypts from itself and the block
+// before it, so a read only fetches the ciphertext it covers plus 16 bytes.
+#define AES_READER_WINDOW 512  // plaintext bytes decrypted per fetch
+
+/**
+ * @brief Fetches ciphertext bytes for Aes256CbcReader
+ * @param offset Offset into the encrypted file (0 = first IV byte)
+ * @param buf Output
+ * @param len Bytes to read
+ * @param ctx Caller context
+ * @return true if all len bytes were read
+ */
+typedef bool (*crypto_fetch_fn)(size_t offset, uint8_t *buf, size_t len, void *ctx);
+
+struct Aes256CbcReader
+{
+    mbedtls_aes_context aes;
+    crypto_fetch_fn fetch;
+    void *ctx;
+    size_t cipher_len;                                  // without IV
+    size_t plain_len;                                   // after PKCS7 unpadding
+    uint8_t window[AES_READER_WINDOW];                  // decrypted plaintext
+    size_t window_start;
+    size_t window_len;
+    uint8_t scratch[AES_IV_SIZE + AES_READER_WINDOW];   // previous block + ciphertext
+};
+
+/**
+ * @brief Open a reader; validates the padding of the last block
+ * @param r Reader state
+ * @param key 32-byte AES key
+ * @param input_len Total encrypted length (IV + ciphertext)
+ * @param fetch Ciphertext source
+ * @param ctx Passed to fetch
+ * @return true if the input is well formed; r.plain_len is then valid
+ */
+bool aes256_cbc_reader_open(Aes256CbcReader &r, const uint8_t *key, size_t input_len,
+                            crypto_fetch_fn fetch, void *ctx);
+
+/**
+ * @brief Read plaintext at any position
+ * @param r Reader state
+ * @param pos Plaintext offset
+ * @param out Output buffer
+ * @param len Bytes wanted
+ * @return Bytes read (short at end of data), or -1 on fetch/decrypt error
+ */
+int32_t aes256_cbc_reader_read(Aes256CbcReader &r, size_t pos, uint8_t *out, size_t len);
+
+/**
+ * @brief Release the reader
+ */
+void aes256_cbc_reader_close(Aes256CbcReader &r);
+
 /**
  * @brief Parse a hex string into a byte array
  * @param hex Hex string (64 chars for 32 bytes)
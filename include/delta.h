@@ -0,0 +1,115 @@
+#ifndef DELTA_H
+#define DELTA_H
+
+#include <cstdint>
+#include <cstddef>
+#include "mbedtls/sha256.h"
+
+// Delta wire format (plaintext, encrypted like any other content file):
+//   [4]  magic "TDLT"
+//   [1]  version (DELTA_VERSION)
+//   [1]  flags (DELTA_FLAG_*)
+//   [2]  reserved
+//   [8]  base frame hash   — truncated SHA-256 of the frame the delta applies to
+//   [8]  target frame hash — truncated SHA-256 of the result
+//   [4]  target size, little-endian
+//   if DELTA_FLAG_RECTS: [1 count][count x (u16 x, u16 y, u16 w, u16 h)] changed
+//        regions in panel pixels (top-down); count 0 means nothing visible changed
+//   ops until end of data: [skip varint][len varint][len bytes XORed onto the frame]
+// Varints are unsigned LEB128. Bytes past the end of the base frame are zero.
+#define DELTA_MAGIC "TDLT"
+#define DELTA_VERSION 1
+#define DELTA_HEADER_SIZE 28
+#define DELTA_FLAG_RECTS 0x01
+#define DELTA_MAX_RECTS 8
+#define FRAME_HASH_SIZE 8
+#define FRAME_HASH_HEX_SIZE (FRAME_HASH_SIZE * 2 + 1)
+
+struct DeltaRect
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+};
+
+struct DeltaHeader
+{
+    uint8_t base_hash[FRAME_HASH_SIZE];
+    uint8_t target_hash[FRAME_HASH_SIZE];
+    uint32_t target_size;
+    bool has_rects;      // false: producer could not tell what changed (e.g. PNG)
+    uint8_t rect_count;
+    DeltaRect rects[DELTA_MAX_RECTS];
+    size_t ops_offset;   // first op byte after header and rect table
+};
+
+/**
+ * @brief Callback for each XOR run of a delta
+ * @param offset Frame offset the run starts at
+ * @param bytes XOR bytes
+ * @param len Run length
+ * @param ctx Caller context
+ */
+typedef void (*delta_run_fn)(size_t offset, const uint8_t *bytes, size_t len, void *ctx);
+
+/**
+ * @brief Parse and validate a delta header
+ * @param delta Decrypted delta data
+ * @param len Length of delta data
+ * @param out Parsed header
+ * @return true if magic, version and length are valid
+ */
+bool delta_parse_header(const uint8_t *delta, size_t len, DeltaHeader &out);
+
+/**
+ * @brief Walk the XOR runs of a delta, validating them against the target size
+ * @param delta Decrypted delta data (header + ops)
+ * @param delta_len Length of delta data
+ * @param fn Called once per run, in frame order
+ * @param ctx Passed to fn
+ * @return true if every op was well formed and inside the target frame
+ */
+bool delta_for_each_run(const uint8_t *delta, size_t delta_len, delta_run_fn fn, void *ctx);
+
+/**
+ * @brief Total area of the changed regions in a parsed header, in pixels
+ */
+uint32_t delta_rect_area(const DeltaHeader &header);
+
+/**
+ * @brief Apply a delta in place
+ * @param delta Decrypted delta data (header + ops)
+ * @param delta_len Length of delta data
+ * @param frame Base frame on input, target frame on output
+ * @param frame_cap Capacity of frame buffer (must be >= target size)
+ * @param frame_len In: base frame length. Out: target frame length
+ * @return true on success; the frame is left untouched if the delta is malformed
+ */
+bool delta_apply(const uint8_t *delta, size_t delta_len,
+                 uint8_t *frame, size_t frame_cap, size_t *frame_len);
+
+/**
+ * @brief Compute the truncated SHA-256 used to identify frames
+ * @param data Frame data
+ * @param len Length of frame data
+ * @param out FRAME_HASH_SIZE-byte output
+ */
+void frame_hash(const uint8_t *data, size_t len, uint8_t *out);
+
+// Incremental frame_hash() for data that arrives in pieces
+struct FrameHasher
+{
+    mbedtls_sha256_context sha;
+};
+
+void frame_hash_begin(FrameHasher &h);
+void frame_hash_update(FrameHasher &h, const uint8_t *data, size_t len);
+void frame_hash_finish(FrameHasher &h, uint8_t *out);
+
+/**
+ * @brief Format a frame hash as lowercase hex (FRAME_HASH_HEX_SIZE incl. terminator)
+ */
+void frame_hash_to_hex(const uint8_t *hash, char *out);
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef DISPLAY_DIRECT_H
+#define DISPLAY_DIRECT_H
+
+#include <cstdint>
+#include <cstddef>
+#include "refresh_policy.h"
+
+// bb_epaper paths that bypass display_show_image() for the mono 800x480 panels
+#define DISPLAY_DIRECT_WIDTH 800
+#define DISPLAY_DIRECT_HEIGHT 480
+#define DISPLAY_DIRECT_FRAME_BYTES (DISPLAY_DIRECT_WIDTH / 8 * DISPLAY_DIRECT_HEIGHT)
+
+/**
+ * @brief Whether this board supports the direct paths below
+ * False on FastEPD (TRMNL X) and colour panels — those always take display_show_image().
+ */
+bool display_direct_supported();
+
+/**
+ * @brief bb_epaper's own framebuffer, to decode a frame into without a second copy
+ * @return DISPLAY_DIRECT_FRAME_BYTES bytes (top-down, MSB = leftmost pixel), or
+ *         nullptr if bbep has no writable RAM buffer; then bring your own
+ */
+uint8_t *display_direct_framebuffer();
+
+/**
+ * @brief Refresh the panel from a top-down packed 1-bpp framebuffer
+ * @param framebuffer display_direct_framebuffer() or another DISPLAY_DIRECT_FRAME_BYTES buffer
+ * @param invert Palette is reversed (as reported by parseBMPHeader())
+ * @param mode Waveform from refresh_policy_panel_mode()
+ * @return true if the panel was refreshed
+ */
+bool display_show_framebuffer(uint8_t *framebuffer, bool invert, PanelRefresh mode);
+
+/**
+ * @brief Fills the framebuffer with the next plane of a frame
+ * @return false if the frame can't be produced
+ */
+typedef bool (*display_fill_fn)(uint8_t *framebuffer, void *ctx);
+
+/**
+ * @brief Whether display_show_gray() can drive this panel in 4-gray
+ */
+bool display_gray_supported();
+
+/**
+ * @brief Show a 4-gray frame the way png_to_epd() does
+ * Switches bbep to the display profile's 4-gray panel type, loads the
+ * framebuffer's current contents (high bit of each 2-bpp level) as PLANE_1,
+ * lets fill_low produce the low bits for PLANE_0, runs a full refresh and
+ * switches back to the 1-bit panel type.
+ * @param framebuffer DISPLAY_DIRECT_FRAME_BYTES, holding the high bits
+ * @param temp_profile Display profile from NVS (temp_profile), as in display_init()
+ * @param fill_low Writes the low bits into framebuffer
+ * @param ctx Passed to fill_low
+ * @return true if the panel was refreshed; false if fill_low failed
+ */
+bool display_show_gray(uint8_t *framebuffer, uint32_t temp_profile, display_fill_fn fill_low, void *ctx);
+
+/**
+ * @brief Partial refresh of a 1-bpp BMP frame that differs from the panel by a delta
+ * The previous frame (target XOR delta) is loaded as the controller's old image
+ * and the new frame as its new image. The refresh covers the whole panel, but
+ * the partial waveform only drives pixels that differ between the two. Caller
+ * must have checked that the panel shows the delta's base.
+ * @param bmp Decrypted target BMP (not modified)
+ * @param bmp_len Length of bmp
+ * @param delta Decrypted delta that produced bmp
+ * @param delta_len Length of delta
+ * @param scratch DISPLAY_DIRECT_FRAME_BYTES of working memory
+ * @return true if the panel was refreshed; false leaves the panel untouched
+ */
+bool display_show_bmp_delta(const uint8_t *bmp, size_t bmp_len,
+                            const uint8_t *delta, size_t delta_len, uint8_t *scratch);
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef FRAME_CACHE_H
+#define FRAME_CACHE_H
+
+#include <cstdint>
+#include <cstddef>
+#include "delta.h"
+
+/**
+ * @brief Read the hash and size of the cached frame for a screen (header only)
+ * @param screen_name Manifest screen name
+ * @param hash_out FRAME_HASH_SIZE-byte output
+ * @param size_out Frame size in bytes
+ * @return true if a valid cached frame exists
+ */
+bool frame_cache_peek(const char *screen_name, uint8_t *hash_out, size_t *size_out);
+
+/**
+ * @brief Map the cached frame for a screen straight from flash (no copy)
+ * Only available with the raw image store partition; the pointer is read-only
+ * and valid until the next frame_cache_map() or cache write.
+ * @param screen_name Manifest screen name
+ * @param size_out Frame size in bytes
+ * @return Pointer to the frame, or nullptr (no image store, or not cached)
+ */
+const uint8_t *frame_cache_map(const char *screen_name, size_t *size_out);
+
+/**
+ * @brief Read the cached frame for a screen into a caller-provided buffer
+ * @param screen_name Manifest screen name
+ * @param buffer Output buffer
+ * @param capacity Buffer capacity (must be >= size from frame_cache_peek())
+ * @param size_out Bytes read
+ * @return true on success
+ */
+bool frame_cache_read(const char *screen_name, uint8_t *buffer, size_t capacity, size_t *size_out);
+
+/**
+ * @brief Store a decoded frame as the new base for a screen
+ * Skips the flash write when the cached frame already has the same hash.
+ * @param screen_name Manifest screen name
+ * @param data Decrypted frame
+ * @param len Frame length
+ * @return true if the cache now holds this frame
+ */
+bool frame_cache_store(const char *screen_name, const uint8_t *data, size_t len);
+
+/**
+ * @brief Start storing a frame that arrives in pieces (one writer at a time)
+ * The header is written up front, so hash and size must be known: take them
+ * from the manifest and let frame_cache_commit() check them.
+ * @param screen_name Manifest screen name
+ * @param hash Expected FRAME_HASH_SIZE-byte frame hash
+ * @param len Expected frame length
+ * @return true if the writer is open; false leaves the old cache entry alone
+ */
+bool frame_cache_begin(const char *screen_name, const uint8_t *hash, size_t len);
+
+/**
+ * @brief Append the next piece of the frame started with frame_cache_begin()
+ * @return false on write error or if more than the expected length arrives
+ */
+bool frame_cache_append(const uint8_t *data, size_t len);
+
+/**
+ * @brief Finish the streamed frame and make it the new base
+ * @param hash Hash of the data actually written; must match frame_cache_begin()
+ * @return true if the cache now holds the frame; otherwise the entry is removed
+ */
+bool frame_cache_commit(const uint8_t *hash);
+
+/**
+ * @brief Drop a streamed frame that will not be completed
+ */
+void frame_cache_abort();
+
+/**
+ * @brief Evict SPIFFS cache entries, least recently used first, until a file fits
+ * For other SPIFFS users (the PNG/JPEG spool); the raw image store is not touched.
+ * @param bytes Size of the file about to be written
+ * @return true if SPIFFS now has bytes free plus garbage-collection slack
+ */
+bool frame_cache_make_room(size_t bytes);
+
+#endif
@@ -3,13 +3,49 @@
 
 #include <cstdint>
 #include <cstddef>
+#include "arena.h"
+
+#define HTTPS_TIMEOUT_MS 15000  // connect and response timeout unless https_set_timeout() says otherwise
+
+/**
+ * @brief Connect/response timeout for the following requests
+ * @param timeout_ms Milliseconds, 0 restores HTTPS_TIMEOUT_MS
+ */
+void https_set_timeout(uint32_t timeout_ms);
+
+/**
+ * @brief Time from starting the last request to its response headers
+ * Covers DNS, TCP connect and the TLS handshake; an origin's latency.
+ */
+uint32_t https_last_latency_ms();
 
 /**
- * @brief Download a file from an HTTPS URL into a PSRAM-allocated buffer
+ * @brief Download a file from an HTTPS URL into an arena buffer
  * @param url Full HTTPS URL to download
  * @param out_size Pointer to store the downloaded data size
- * @return Pointer to PSRAM-allocated buffer (caller must free with free()), or nullptr on error
+ * @param arena Arena the buffer is taken from (released with the arena, never freed)
+ * @return Pointer into the arena, or nullptr on error
+ */
+uint8_t *https_download(const char *url, size_t *out_size, Arena &arena);
+
+/**
+ * @brief Receives downloaded bytes as they arrive
+ * @param data Chunk of the response body
+ * @param len Chunk length
+ * @param ctx Caller context
+ * @return false to abort the download
+ */
+typedef bool (*https_chunk_fn)(const uint8_t *data, size_t len, void *ctx);
+
+/**
+ * @brief Download a file from an HTTPS URL without buffering it
+ * Chunks go to on_chunk in order through a small stack buffer.
+ * @param url Full HTTPS URL to download
+ * @param on_chunk Called for each received chunk
+ * @param ctx Passed to on_chunk
+ * @param out_size Pointer to store the number of bytes delivered
+ * @return true if the whole body was delivered and on_chunk never aborted
  */
-uint8_t *https_download(const char *url, size_t *out_size);
+bool https_download_stream(const char *url, https_chunk_fn on_chunk, void *ctx, size_t *out_size);
 
 #endif
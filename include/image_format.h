@@ -0,0 +1,48 @@
+#ifndef IMAGE_FORMAT_H
+#define IMAGE_FORMAT_H
+
+#include <cstdint>
+#include <cstddef>
+
+// bb_epaper G5 bitmap header: [uint16 marker][int16 w][int16 h][uint16 size]
+#define G5_MARKER 0xBBBF
+#define G5_HEADER_SIZE 8
+
+enum ImageFormat
+{
+    IMAGE_FORMAT_UNKNOWN = 0,
+    IMAGE_FORMAT_BMP,
+    IMAGE_FORMAT_PNG,
+    IMAGE_FORMAT_JPEG,
+    IMAGE_FORMAT_G5,
+};
+
+/**
+ * @brief Detect image format from magic bytes
+ * @param data Decrypted image data
+ * @param len Length of data
+ * @return Detected format, IMAGE_FORMAT_UNKNOWN if unrecognised or too short
+ */
+ImageFormat detect_image_format(const uint8_t *data, size_t len);
+
+/**
+ * @brief Map a manifest "format" string ("bmp", "png", "jpeg", "g5") to ImageFormat
+ * @param name Format name (nullptr or empty gives IMAGE_FORMAT_UNKNOWN)
+ * @return Matching format, IMAGE_FORMAT_UNKNOWN if not recognised
+ */
+ImageFormat image_format_from_name(const char *name);
+
+/**
+ * @brief Short display name for logs ("BMP", "PNG", "JPEG", "G5", "unknown")
+ */
+const char *image_format_name(ImageFormat format);
+
+/**
+ * @brief Validate a G5 bitmap header against the buffer that holds it
+ * @param data Image data starting with the G5 header
+ * @param len Length of data
+ * @return true if the marker matches and the declared stream fits in len
+ */
+bool g5_header_valid(const uint8_t *data, size_t len);
+
+#endif
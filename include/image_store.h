@@ -0,0 +1,107 @@
+#ifndef IMAGE_STORE_H
+#define IMAGE_STORE_H
+
+#include <cstdint>
+#include <cstddef>
+#include "delta.h"
+
+// Raw image store: a flash partition (label IMAGE_STORE_LABEL, see
+// min_spiffs_imgstore.csv) cut into fixed-size slots. Each slot is
+// [ImageSlotHeader][image bytes] and is read back through esp_partition_mmap,
+// so the display driver can take the image straight from mapped flash.
+//
+// A write goes to a fresh slot (erased, superseded, or least recently
+// written) rather than over the screen's current one, which spreads erases
+// across the partition and keeps the old frame until the new one is complete.
+// The header's magic is written last; a slot without it is ignored.
+#define IMAGE_STORE_LABEL "imgstore"
+#define IMAGE_STORE_SLOT_SIZE (256 * 1024)  // multiple of the 64 KB mmap page
+#define IMAGE_STORE_MAX_SLOTS 32
+#define IMAGE_SLOT_MAGIC 0x534D4749         // "IGMS" little-endian
+#define IMAGE_SLOT_HEADER_SIZE 32
+
+struct ImageSlotHeader
+{
+    uint32_t magic;        // IMAGE_SLOT_MAGIC when the slot is complete
+    uint32_t seq;          // write order across the whole store, 1-based
+    uint32_t key;          // screen key (hash of the screen name)
+    uint32_t size;         // image bytes after the header
+    uint8_t hash[FRAME_HASH_SIZE];
+    uint32_t erase_count;  // times this slot has been erased
+    uint32_t reserved;
+};
+
+// ---- Slot table logic (no flash access) ----
+
+/**
+ * @brief Whether a header describes a complete image that fits its slot
+ */
+bool image_slot_valid(const ImageSlotHeader &h, size_t slot_size);
+
+/**
+ * @brief Newest valid slot for a key
+ * @return Slot index, or -1 if the key has none
+ */
+int image_slots_find(const ImageSlotHeader *slots, int count, size_t slot_size, uint32_t key);
+
+/**
+ * @brief Slot to write the next image for key into
+ * Order of preference: never-used or invalid, superseded (an older copy of
+ * any key), then the least recently written. The key's current slot is never
+ * chosen, so its frame survives until the new one is committed.
+ * @return Slot index, or -1 if count < 2
+ */
+int image_slots_pick(const ImageSlotHeader *slots, int count, size_t slot_size, uint32_t key);
+
+/**
+ * @brief Sequence number for the next write
+ */
+uint32_t image_slots_next_seq(const ImageSlotHeader *slots, int count, size_t slot_size);
+
+// ---- Flash-backed store ----
+
+/**
+ * @brief Find the partition and read the slot table (safe to call repeatedly)
+ * @return false if the partition isn't in this build's partition table
+ */
+bool image_store_init();
+
+/**
+ * @brief Header of the newest image stored under key
+ * @return true if found
+ */
+bool image_store_lookup(uint32_t key, ImageSlotHeader &out);
+
+/**
+ * @brief Map the newest image stored under key into the address space
+ * The pointer stays valid until the next image_store_map() or write; it is
+ * read-only flash.
+ * @param key Screen key
+ * @param size_out Image size
+ * @return Pointer to the image bytes, or nullptr
+ */
+const uint8_t *image_store_map(uint32_t key, size_t *size_out);
+
+/**
+ * @brief Start writing an image of known size and hash (erases only what it needs)
+ * @return false if it can't fit a slot or the erase fails
+ */
+bool image_store_begin(uint32_t key, const uint8_t *hash, size_t len);
+
+/**
+ * @brief Append image bytes to the write started by image_store_begin()
+ */
+bool image_store_append(const uint8_t *data, size_t len);
+
+/**
+ * @brief Finish the write: header first, magic last
+ * @return true if the slot is now the key's newest image
+ */
+bool image_store_commit();
+
+/**
+ * @brief Give up on the current write; the slot stays invalid
+ */
+void image_store_abort();
+
+#endif
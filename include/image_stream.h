@@ -0,0 +1,83 @@
+#ifndef IMAGE_STREAM_H
+#define IMAGE_STREAM_H
+
+#include <cstdint>
+#include <cstddef>
+#include "image_format.h"
+#include "arena.h"
+
+// PNG/JPEG screens without a RAM copy of the file: the download is spooled to
+// flash still encrypted, and PNGdec/JPEGDEC pull plaintext through their file
+// callbacks from an Aes256CbcReader over that spool. Peak RAM is the decoder
+// state plus one decrypt window, independent of file size.
+//
+// Pixels are converted as png_to_epd()/jpeg_to_epd() do for a RAM buffer
+// (those only open RAM, so the conversion is repeated here): PNG gray is
+// reduced to 2 bits like ReduceBpp(), one bit per decode pass, and JPEG is
+// dithered to 1 bit.
+
+// Which bit of the 2-bpp gray level a decode pass writes. The high bit alone
+// is the 1-bpp image (threshold at mid-gray).
+#define IMAGE_STREAM_HIGH_BIT 1
+#define IMAGE_STREAM_LOW_BIT 0
+
+enum SpoolResult
+{
+    SPOOL_OK,
+    SPOOL_DOWNLOAD_FAILED,  // origin or network; another mirror may work
+    SPOOL_STORAGE_FAILED,   // flash full or unwritable; retrying won't help
+};
+
+/**
+ * @brief Make room on flash for the spool, evicting frame cache entries if needed
+ * @param enc_size Encrypted size from the manifest
+ * @return false if SPIFFS can't be mounted or can't free enough space
+ */
+bool image_stream_reserve(size_t enc_size);
+
+/**
+ * @brief Download an encrypted image to the flash spool
+ * @param url Full HTTPS URL
+ * @param out_size Encrypted bytes written (also on failure)
+ * @return SPOOL_OK if the whole file is on flash
+ */
+SpoolResult image_stream_spool(const char *url, size_t *out_size);
+
+/**
+ * @brief Hash the spooled plaintext and, if expected_hash is given, stream it into the frame cache
+ * @param key 32-byte AES key
+ * @param screen_name Manifest screen name (frame cache entry)
+ * @param expected_hash Manifest hash (FRAME_HASH_SIZE bytes) or nullptr to skip caching
+ * @param hash_out FRAME_HASH_SIZE-byte hash of the plaintext
+ * @param plain_size_out Plaintext size
+ * @return false if the spool can't be read or decrypted
+ */
+bool image_stream_digest(const uint8_t *key, const char *screen_name, const uint8_t *expected_hash,
+                         uint8_t *hash_out, size_t *plain_size_out);
+
+/**
+ * @brief Decode one 1-bpp plane of the spooled PNG/JPEG
+ * @param format IMAGE_FORMAT_PNG or IMAGE_FORMAT_JPEG
+ * @param key 32-byte AES key
+ * @param framebuffer DISPLAY_DIRECT_FRAME_BYTES, top-down, 1 = white
+ * @param arena Decoder objects are placed here; rewind after the call
+ * @param level_bit IMAGE_STREAM_HIGH_BIT or IMAGE_STREAM_LOW_BIT (PNG; JPEG is always dithered)
+ * @param levels_out If not nullptr, bit n set when gray level n (0 = black .. 3 = white) occurs
+ * @return true if the image matched the panel size and decoded completely
+ */
+bool image_stream_decode(ImageFormat format, const uint8_t *key, uint8_t *framebuffer, Arena &arena,
+                         int level_bit, uint8_t *levels_out);
+
+/**
+ * @brief Whether a decode needs 4-gray, i.e. uses more than two gray levels
+ * Two-level images go out as 1-bpp with a partial refresh, as in png_to_epd().
+ * @param levels levels_out from image_stream_decode()
+ */
+bool image_stream_is_gray(uint8_t levels);
+
+/**
+ * @brief Delete the spool file
+ */
+void image_stream_discard();
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdarg>
+
+// Log calls store a compact binary record instead of a formatted line: the
+// format string and file pointers (both in flash, so valid for the life of
+// the firmware image), line, level, timestamp and the raw arguments. Text is
+// produced only when a record is popped, i.e. when a serial host is there to
+// read it. The ring lives in RTC memory, so records from earlier wakes are
+// still waiting when a host attaches later.
+#define LOG_RING_MAGIC 0x31474C52   // "RLG1"
+#define LOG_RING_SIZE 2048          // bytes of record storage
+#define LOG_RING_MAX_ARGS 8         // further arguments print as "?"
+#define LOG_RING_MAX_STR 48         // %s arguments are copied, truncated to this
+// Largest record, for buffers passed to log_ring_encode() / log_ring_take()
+#define LOG_RING_RECORD_MAX (32 + LOG_RING_MAX_ARGS * (1 + LOG_RING_MAX_STR + 8))
+
+// With several writers, encode and format outside the lock and hold it only
+// for log_ring_push() / log_ring_take(), which just copy bytes.
+// log_ring_vrecord() and log_ring_pop() do both steps in one call.
+
+struct LogRing
+{
+    uint32_t magic;
+    uint32_t image;     // firmware the stored pointers belong to
+    uint16_t head;      // offset of the oldest record
+    uint16_t used;      // bytes held, whole records only
+    uint16_t dropped;   // records overwritten before anyone read them
+    uint16_t wake;      // bumped once per boot, stamped into each record
+    uint8_t data[LOG_RING_SIZE];
+};
+
+struct LogRingEntry
+{
+    uint8_t level;
+    uint16_t wake;
+    uint32_t time_ms;
+    const char *file;
+    int line;
+};
+
+/**
+ * @brief Empty the ring and stamp it valid for this firmware
+ * @param image Identifies the running firmware (e.g. from its ELF hash)
+ */
+void log_ring_reset(LogRing &ring, uint32_t image);
+
+/**
+ * @brief Whether the ring was written by this firmware and every record length is consistent
+ * RTC memory after a power-on or brownout holds garbage, and after an update
+ * the stored format pointers point into the old image; reset it then.
+ */
+bool log_ring_valid(const LogRing &ring, uint32_t image);
+
+/**
+ * @brief Build a record without touching the ring
+ * Only scans the format for conversion types; nothing is formatted.
+ * @param rec LOG_RING_RECORD_MAX bytes
+ * @param format Must stay valid until the record is formatted (a literal)
+ * @param file Same lifetime requirement as format
+ * @return Record length
+ */
+size_t log_ring_encode(uint8_t *rec, uint8_t level, uint32_t time_ms,
+                       const char *file, int line, const char *format, va_list args);
+
+/**
+ * @brief Append an encoded record, stamped with the ring's wake, dropping the oldest ones if space runs out
+ * @return false if the record is larger than the ring
+ */
+bool log_ring_push(LogRing &ring, uint8_t *rec, size_t len);
+
+/**
+ * @brief Copy the oldest record out and remove it
+ * @param rec LOG_RING_RECORD_MAX bytes
+ * @return Record length, 0 if the ring is empty (or was corrupt and got reset)
+ */
+size_t log_ring_take(LogRing &ring, uint8_t *rec);
+
+/**
+ * @brief Format a record from log_ring_take()
+ * Reads stay within len; arguments missing from a damaged record print as '?'.
+ * @param len Record length returned by log_ring_take()
+ * @param msg Receives the message text, truncated to msg_size
+ */
+void log_ring_format(const uint8_t *rec, size_t len, LogRingEntry &entry, char *msg, size_t msg_size);
+
+/**
+ * @brief Encode and append one record (log_ring_encode() + log_ring_push())
+ * Only scans the format for conversion types; nothing is formatted.
+ * @param format Must stay valid until the record is popped (a literal)
+ * @param file Same lifetime requirement as format
+ * @return false if the record alone is larger than the ring
+ */
+bool log_ring_vrecord(LogRing &ring, uint8_t level, uint32_t time_ms,
+                      const char *file, int line, const char *format, va_list args);
+
+/**
+ * @brief Format the oldest record into msg and remove it (log_ring_take() + log_ring_format())
+ * @param msg Receives the message text, truncated to msg_size
+ * @return false if the ring is empty
+ */
+bool log_ring_pop(LogRing &ring, LogRingEntry &entry, char *msg, size_t msg_size);
+
+#endif // LOG_RING_H
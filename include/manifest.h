@@ -2,14 +2,22 @@
 #define MANIFEST_H
 
 #include <Arduino.h>
+#include "image_format.h"
+#include "arena.h"
 
 #define MANIFEST_MAX_SCREENS 16
+#define MANIFEST_MAX_MIRRORS 4
 
 struct ManifestScreen
 {
     String name;
     String filename;
     size_t size;
+    ImageFormat format;  // from "format"; IMAGE_FORMAT_UNKNOWN if the manifest predates it
+    String hash;         // truncated SHA-256 of the plaintext (hex), empty if absent
+    String delta_filename;  // delta that turns the delta_base frame into this one, empty if none
+    String delta_base;
+    size_t delta_size;
 };
 
 struct Manifest
@@ -17,6 +25,8 @@ struct Manifest
     int version;
     int refresh_rate;
     String updated_at;
+    int mirror_count;
+    String mirrors[MANIFEST_MAX_MIRRORS];  // extra image base URLs, tried alongside images_base
     int screen_count;
     ManifestScreen screens[MANIFEST_MAX_SCREENS];
 };
@@ -26,8 +36,9 @@ struct Manifest
  * @param json Pointer to JSON string (null-terminated not required)
  * @param len Length of JSON data
  * @param out Output Manifest struct
+ * @param scratch Arena for the JSON document pool (nullptr = heap); rewind it after the call
  * @return true on success, false on parse error
  */
-bool parse_manifest(const uint8_t *json, size_t len, Manifest &out);
+bool parse_manifest(const uint8_t *json, size_t len, Manifest &out, Arena *scratch = nullptr);
 
 #endif
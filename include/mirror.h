@@ -0,0 +1,54 @@
+#ifndef MIRROR_H
+#define MIRROR_H
+
+#include <Arduino.h>
+#include "mirror_stats.h"
+#include "arena.h"
+
+// A group of interchangeable origins for the same files, e.g. the GitHub
+// Pages site and a raw CDN copy of the repo. Requests go to the best ranked
+// origin first with a short timeout and fall over to the next one.
+struct MirrorSet
+{
+    int count;
+    String origins[MIRROR_MAX];   // full manifest URLs, or image base URLs
+    uint32_t keys[MIRROR_MAX];
+};
+
+/**
+ * @brief One download attempt against a full URL
+ * @param url Origin + path
+ * @param ctx Caller context
+ * @param delivered Set to the bytes handed to a consumer that can't start over;
+ *                  the next origin is only tried while this stays 0
+ * @return true on success
+ */
+typedef bool (*mirror_fetch_fn)(const char *url, void *ctx, size_t *delivered);
+
+/**
+ * @brief Load the RTC statistics and age them by one wake
+ * Call once per wake before the first mirror_fetch().
+ */
+void mirror_begin();
+
+/**
+ * @brief Add origins from a list separated by spaces, commas or semicolons
+ * Duplicates and entries beyond MIRROR_MAX are skipped.
+ * @return Origins in the set afterwards
+ */
+int mirror_set_add(MirrorSet &set, const String &list);
+
+/**
+ * @brief Run fn against each origin + path, best ranked first, until one succeeds
+ * @return true if an origin succeeded
+ */
+bool mirror_fetch(const MirrorSet &set, const char *path, mirror_fetch_fn fn, void *ctx);
+
+/**
+ * @brief https_download() with failover across the set
+ * Buffers from failed attempts are given back to the arena.
+ * @return Pointer into the arena, or nullptr if every origin failed
+ */
+uint8_t *mirror_download(const MirrorSet &set, const char *path, size_t *out_size, Arena &arena);
+
+#endif // MIRROR_H
@@ -0,0 +1,91 @@
+#ifndef MIRROR_STATS_H
+#define MIRROR_STATS_H
+
+#include <cstdint>
+#include <cstddef>
+
+// Per-origin download statistics, kept in RTC memory across deep sleep. An
+// origin is scheme://host[:port], so a manifest and an image base on the same
+// host share one entry. Healthy origins are tried fastest first (never-measured
+// ones before measured ones, so each gets timed once); an origin that failed
+// is moved to the back for a number of wakes that doubles with each failure.
+#define MIRROR_MAX 4                // origins per group (manifest, images)
+#define MIRROR_STATS_SLOTS 8
+#define MIRROR_STATS_MAGIC 0x3152494D  // "MIR1"
+#define MIRROR_PENALTY_MAX_SHIFT 6     // back of the queue for at most 64 wakes
+
+// Connect/response timeout while another origin is left to try. The last
+// origin gets the normal HTTPS timeout.
+#define MIRROR_TIMEOUT_FACTOR 4
+#define MIRROR_MIN_TIMEOUT_MS 3000
+#define MIRROR_MAX_TIMEOUT_MS 6000
+
+struct MirrorStat
+{
+    uint32_t key;           // mirror_origin_key(), 0 = free slot
+    uint16_t latency_ms;    // smoothed time to response headers, 0 = never measured
+    uint8_t failures;       // consecutive failures
+    uint8_t penalty;        // wakes left at the back of the queue
+    uint8_t age;            // wakes since last used, picks the slot to evict
+    uint8_t reserved[3];
+};
+
+struct MirrorStats
+{
+    uint32_t magic;
+    MirrorStat slots[MIRROR_STATS_SLOTS];
+    uint32_t checksum;
+};
+
+/**
+ * @brief Hash of the scheme and authority part of a URL
+ * @return Never 0
+ */
+uint32_t mirror_origin_key(const char *url);
+
+/**
+ * @brief Forget every origin
+ */
+void mirror_stats_reset(MirrorStats &s);
+
+/**
+ * @brief Whether RTC memory holds a sealed table
+ */
+bool mirror_stats_valid(const MirrorStats &s);
+
+/**
+ * @brief Stamp magic and checksum after changing entries
+ */
+void mirror_stats_seal(MirrorStats &s);
+
+/**
+ * @brief Age every entry by one wake; call once per wake
+ */
+void mirror_stats_tick(MirrorStats &s);
+
+/**
+ * @brief Record the outcome of one request to an origin
+ * @param latency_ms Time to response headers (ignored on failure)
+ */
+void mirror_stats_record(MirrorStats &s, uint32_t key, bool ok, uint32_t latency_ms);
+
+/**
+ * @brief Entry for an origin, or nullptr if it has none
+ */
+const MirrorStat *mirror_stats_find(const MirrorStats &s, uint32_t key);
+
+/**
+ * @brief Order origins best first; ties keep the configured order
+ * @param keys Origin keys in configured order
+ * @param order Receives count indices into keys
+ */
+void mirror_rank(const MirrorStats &s, const uint32_t *keys, int count, int *order);
+
+/**
+ * @brief Connect/response timeout for a request to an origin
+ * @param last No origin left after this one
+ * @return Milliseconds, or 0 for the normal HTTPS timeout
+ */
+uint32_t mirror_timeout_ms(const MirrorStats &s, uint32_t key, bool last);
+
+#endif // MIRROR_STATS_H
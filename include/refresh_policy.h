@@ -0,0 +1,82 @@
+#ifndef REFRESH_POLICY_H
+#define REFRESH_POLICY_H
+
+#include <cstdint>
+#include <cstddef>
+#include "delta.h"
+
+// Force a full image refresh after this many partials (ghosting)
+#define REFRESH_MAX_PARTIALS 8
+// Sleeps this long or longer use the fast waveform instead of partials, as in
+// display_show_image()
+#define REFRESH_FAST_MIN_SLEEP_SECONDS 1800
+// Changed area above this share of the panel goes through the full image path,
+// where a full refresh costs about the same and clears ghosting
+#define REFRESH_MAX_PARTIAL_AREA_PCT 40
+
+// Kept in RTC memory across deep sleep, next to need_to_refresh_display
+struct RefreshState
+{
+    uint8_t partials_since_full;
+    uint8_t displayed_valid;                  // displayed_hash is what the panel shows
+    uint8_t displayed_hash[FRAME_HASH_SIZE];
+};
+
+enum RefreshAction
+{
+    REFRESH_ACTION_FULL,     // hand the whole image to display_show_image()
+    REFRESH_ACTION_PARTIAL,  // partial refresh with the delta's base as the old image
+    REFRESH_ACTION_SKIP,     // panel already shows this frame
+};
+
+// Waveform for a frame written straight to the panel (display_show_framebuffer)
+enum PanelRefresh
+{
+    PANEL_REFRESH_FULL,
+    PANEL_REFRESH_FAST,
+    PANEL_REFRESH_PARTIAL,
+};
+
+struct RefreshRequest
+{
+    bool force_full;             // panel content unknown (loading screen, error message, first boot)
+    bool partial_capable;        // frame format and panel support the delta partial refresh
+    const uint8_t *target_hash;  // frame about to be shown
+    const DeltaHeader *delta;    // delta that produced the frame, nullptr for a full image
+    uint32_t panel_area;         // width * height in pixels
+};
+
+/**
+ * @brief Decide how to get the panel from what it shows now to the requested frame
+ * @param state Bookkeeping from previous wakes
+ * @param req Frame about to be shown
+ * @return Action to take
+ */
+RefreshAction refresh_policy_decide(const RefreshState &state, const RefreshRequest &req);
+
+/**
+ * @brief Pick the waveform for a whole 1-bpp frame the way display_show_image() does
+ * Partial normally; full when the panel content is unknown or after
+ * REFRESH_MAX_PARTIALS partials; fast when sleeping REFRESH_FAST_MIN_SLEEP_SECONDS+.
+ * Record a partial as REFRESH_ACTION_PARTIAL and the others as REFRESH_ACTION_FULL.
+ * @param state Bookkeeping from previous wakes
+ * @param force_full Panel content unknown (loading screen, error message, first boot)
+ * @param sleep_seconds Time until the next refresh
+ * @return Waveform to use
+ */
+PanelRefresh refresh_policy_panel_mode(const RefreshState &state, bool force_full, uint32_t sleep_seconds);
+
+/**
+ * @brief Update bookkeeping after an action has been carried out
+ * @param state Bookkeeping to update
+ * @param action Action actually taken
+ * @param target_hash Frame now on the panel
+ */
+void refresh_policy_record(RefreshState &state, RefreshAction action, const uint8_t *target_hash);
+
+/**
+ * @brief Short name for logs
+ */
+const char *refresh_action_name(RefreshAction action);
+
+#endif
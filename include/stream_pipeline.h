@@ -0,0 +1,34 @@
+#ifndef STREAM_PIPELINE_H
+#define STREAM_PIPELINE_H
+
+#include <cstdint>
+#include <cstddef>
+#include "arena.h"
+#include "github_client.h"
+
+// Two-stage download for dual-core targets built with -D STREAM_PIPELINE:
+// the calling task reads the socket into a ring of chunk buffers, a task
+// pinned to the other core drains them into on_chunk (decrypt/decode). When
+// the ring is full the network side waits, so memory stays bounded.
+// Everywhere else — single-core chips, no flag, no memory for the ring —
+// it is https_download_stream() in the calling task.
+#define PIPELINE_SLOTS 4
+#define PIPELINE_SLOT_SIZE 4096
+#define PIPELINE_TASK_STACK 8192
+#define PIPELINE_WAIT_MS 10000  // consumer this slow counts as stalled
+
+/**
+ * @brief Download a file, handing the body to on_chunk on the other core
+ * on_chunk is called in order and never concurrently with itself; it has
+ * returned for the last time when this function returns.
+ * @param url Full HTTPS URL to download
+ * @param on_chunk Consumer, runs in the pipeline task
+ * @param ctx Passed to on_chunk
+ * @param out_size Pointer to store the number of bytes downloaded
+ * @param arena Ring buffers are taken from here and released on return
+ * @return true if the whole body was delivered and on_chunk never returned false
+ */
+bool stream_pipeline_download(const char *url, https_chunk_fn on_chunk, void *ctx,
+                              size_t *out_size, Arena &arena);
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef TIMEKEEPER_H
+#define TIMEKEEPER_H
+
+#include <cstdint>
+#include <cstddef>
+
+// Wall clock across deep sleep without NTP on every wake. RTC memory keeps
+// the last NTP epoch plus the awake and asleep time accumulated since; sleep
+// is timed by the RTC slow clock, whose rate error (an RC oscillator, up to a
+// few percent) is learned at each resync. NTP runs only when the estimated
+// error passes TIME_MAX_ERROR_MS or the last sync is TIME_MAX_SYNC_AGE_S old,
+// and then in the background while the wake carries on.
+#define TIME_MAX_ERROR_MS 5000
+#define TIME_MAX_SYNC_AGE_S (24 * 3600)
+#define TIME_NTP_ERROR_US 100000            // SNTP over WiFi, one sample
+#define TIME_AWAKE_DRIFT_PPM 50             // esp_timer runs off the crystal
+#define TIME_DRIFT_UNKNOWN_PPM 50000        // RC slow clock before any learning
+#define TIME_DRIFT_FLOOR_PPM 50             // never trust the model better than this
+#define TIME_MIN_LEARN_SLEEP_S 600          // NTP error swamps drift over shorter spans
+#define TIME_MODEL_MAGIC 0x4B4D4954         // "TIMK"
+
+struct TimeModel
+{
+    uint32_t magic;
+    uint8_t synced;                 // sync_epoch_us is real NTP time
+    uint8_t samples;                // drift measurements taken
+    int64_t sync_epoch_us;          // UTC at the last sync, microseconds
+    int64_t awake_us;               // time awake since then, finished wakes
+    int64_t sleep_us;               // time asleep since then, by the RTC clock
+    int32_t drift_ppm;              // RTC clock error: true = rtc * (1 + ppm/1e6)
+    int32_t drift_uncertainty_ppm;
+    int64_t local_at_sleep_us;      // system clock when the last sleep began
+    uint32_t checksum;
+};
+
+// ---- Model (no clock access) ----
+
+/**
+ * @brief Forget everything; the next wake has to sync
+ */
+void time_model_reset(TimeModel &m);
+
+/**
+ * @brief Whether an RTC copy of the model can be used
+ */
+bool time_model_valid(const TimeModel &m);
+
+/**
+ * @brief Update the checksum after changing fields
+ */
+void time_model_seal(TimeModel &m);
+
+/**
+ * @brief Add a finished wake and the sleep that followed it
+ * @param awake_us Time awake, by the crystal
+ * @param sleep_us Time asleep, by the RTC clock
+ */
+void time_model_advance(TimeModel &m, int64_t awake_us, int64_t sleep_us);
+
+/**
+ * @brief Estimated UTC now, microseconds
+ * @param awake_now_us Time since this wake started
+ */
+int64_t time_model_now_us(const TimeModel &m, int64_t awake_now_us);
+
+/**
+ * @brief Worst-case error of time_model_now_us(), microseconds
+ */
+int64_t time_model_error_us(const TimeModel &m, int64_t awake_now_us);
+
+/**
+ * @brief Whether the estimate is too old or too uncertain
+ */
+bool time_model_needs_sync(const TimeModel &m, int64_t awake_now_us);
+
+/**
+ * @brief Take an NTP result: learn the drift since the last sync, restart counting
+ * @param ntp_epoch_us UTC from NTP, microseconds
+ * @param awake_now_us Time since this wake started, when ntp_epoch_us was taken
+ */
+void time_model_sync(TimeModel &m, int64_t ntp_epoch_us, int64_t awake_now_us);
+
+// ---- System clock + SNTP ----
+
+/**
+ * @brief Account for the sleep that just ended and set the system clock from the model
+ * Call early in setup(), before anything reads the time.
+ */
+void timekeeper_begin();
+
+/**
+ * @brief Start a background SNTP sync if the model needs one (WiFi must be up)
+ */
+void timekeeper_start_sync();
+
+/**
+ * @brief Fold in a finished background sync, if any
+ */
+void timekeeper_poll();
+
+/**
+ * @brief Stop SNTP and record the start of deep sleep
+ */
+void timekeeper_sleep();
+
+#endif
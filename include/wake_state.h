@@ -0,0 +1,108 @@
+#ifndef WAKE_STATE_H
+#define WAKE_STATE_H
+
+#include <cstdint>
+#include <cstddef>
+
+// Hot counters and the config snapshot live in RTC memory across deep sleep,
+// guarded by a checksum. NVS is read on every boot that isn't a deep-sleep
+// wake and whenever the RTC copy is invalid, and written only for fields whose value differs
+// from what NVS last got — a normal wake touches flash zero times.
+#define WAKE_STATE_MAGIC 0x31535357  // "WSS1"
+#define WAKE_STATE_VERSION 1
+#define WAKE_STATE_URL_MAX 256
+#define WAKE_STATE_KEY_HEX_MAX 65
+
+// Fields wake_state_dirty() reports as needing an NVS write
+#define WAKE_DIRTY_WIFI_RETRY 0x01
+#define WAKE_DIRTY_API_RETRY  0x02
+#define WAKE_DIRTY_SLEEP_TIME 0x04
+
+struct WakeState
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;              // sizeof(WakeState), catches layout changes across OTA
+
+    // Live values
+    int32_t wifi_retry;         // progressive WiFi backoff counter, 1 = no failures
+    int32_t api_retry;          // progressive download backoff counter
+    uint32_t sleep_time;        // last deep sleep duration, seconds
+
+    // Values NVS holds, so only real changes are written
+    int32_t nvs_wifi_retry;
+    int32_t nvs_api_retry;
+    uint32_t nvs_sleep_time;
+
+    // Config snapshot, read from NVS once per cold boot
+    uint8_t config_cached;      // 0: a value didn't fit, read NVS every wake
+    char manifest_url[WAKE_STATE_URL_MAX];
+    char images_base[WAKE_STATE_URL_MAX];
+    char aes_key_hex[WAKE_STATE_KEY_HEX_MAX];
+
+    uint32_t checksum;          // CRC-32 of everything above
+};
+
+// ---- Record logic (no RTC or NVS access) ----
+
+/**
+ * @brief CRC-32 of every field before checksum
+ */
+uint32_t wake_state_checksum(const WakeState &s);
+
+/**
+ * @brief Stamp magic, version, size and checksum after changing fields
+ */
+void wake_state_seal(WakeState &s);
+
+/**
+ * @brief Whether RTC memory holds a sealed state of this layout
+ */
+bool wake_state_valid(const WakeState &s);
+
+/**
+ * @brief Fields whose live value differs from NVS (WAKE_DIRTY_* bits)
+ */
+uint8_t wake_state_dirty(const WakeState &s);
+
+// ---- RTC + NVS ----
+
+class Preferences;
+class String;
+
+/**
+ * @brief Take the RTC state, or rebuild it from NVS if it's invalid
+ * Call once per wake after preferences.begin(). If RTC memory survived a
+ * reset that wasn't a deep-sleep wake (crash, watchdog, ESP.restart()),
+ * pending values are committed to NVS and the state, including the config
+ * snapshot, is reloaded from it.
+ * @param prefs Open "data" namespace
+ * @return true if the RTC copy was valid
+ */
+bool wake_state_begin(Preferences &prefs);
+
+/**
+ * @brief Live state; call wake_state_commit() (or let goToSleep) after changes
+ */
+WakeState &wake_state();
+
+/**
+ * @brief Config strings from the snapshot, falling back to NVS then defaults
+ */
+void wake_state_config(Preferences &prefs, String &manifest_url, String &images_base, String &aes_key_hex,
+                       const char *default_manifest_url, const char *default_images_base,
+                       const char *default_aes_key_hex);
+
+/**
+ * @brief Reseal the RTC copy and write changed fields to NVS
+ * @param prefs Open "data" namespace
+ * @return Number of NVS keys written
+ */
+int wake_state_commit(Preferences &prefs);
+
+/**
+ * @brief Drop the RTC copy so the next boot rereads NVS (factory reset)
+ */
+void wake_state_invalidate();
+
+#endif
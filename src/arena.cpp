@@ -0,0 +1,49 @@
+#include "arena.h"
+
+void arena_init(Arena &a, void *buffer, size_t capacity)
+{
+    // Align start and size so every allocation is aligned and the last one fits exactly
+    uintptr_t start = (uintptr_t)buffer;
+    size_t skew = start % ARENA_ALIGN ? ARENA_ALIGN - start % ARENA_ALIGN : 0;
+    if (!buffer || capacity < skew)
+    {
+        a.base = nullptr;
+        a.capacity = 0;
+    }
+    else
+    {
+        a.base = (uint8_t *)buffer + skew;
+        a.capacity = (capacity - skew) & ~(size_t)(ARENA_ALIGN - 1);
+    }
+    a.used = 0;
+    a.high_water = 0;
+    a.allocs = 0;
+    a.failed = 0;
+}
+
+void *arena_alloc(Arena &a, size_t size)
+{
+    size_t rounded = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (!a.base || size == 0 || rounded < size || rounded > a.capacity - a.used)
+    {
+        a.failed++;
+        return nullptr;
+    }
+    void *p = a.base + a.used;
+    a.used += rounded;
+    a.allocs++;
+    if (a.used > a.high_water)
+        a.high_water = a.used;
+    return p;
+}
+
+size_t arena_mark(const Arena &a)
+{
+    return a.used;
+}
+
+void arena_rewind(Arena &a, size_t mark)
+{
+    if (mark <= a.used)
+        a.used = mark;
+}
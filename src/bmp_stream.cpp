@@ -0,0 +1,119 @@
+#include "bmp_stream.h"
+#include <cstring>
+
+static uint32_t read_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static bool fail(BmpStream &s)
+{
+    s.failed = true;
+    return false;
+}
+
+void bmp_stream_begin(BmpStream &s, uint8_t *framebuffer, uint16_t width, uint16_t height)
+{
+    memset(&s, 0, sizeof(s));
+    s.framebuffer = framebuffer;
+    s.width = width;
+    s.height = height;
+    s.failed = !framebuffer || width == 0 || width % 8 != 0 || height == 0;
+}
+
+// Called once the first pixel_offset bytes are buffered
+static bool parse_header(BmpStream &s)
+{
+    const uint8_t *h = s.header;
+    int32_t width = (int32_t)read_u32(h + 18);
+    int32_t height = (int32_t)read_u32(h + 22);
+    uint16_t bpp = read_u16(h + 28);
+    uint32_t compression = read_u32(h + 30);
+
+    if (bpp != 1 || compression != 0)
+        return false;
+    if (width != s.width || (height != s.height && height != -(int32_t)s.height))
+        return false;
+
+    s.file_size = read_u32(h + 2);
+    s.bottom_up = height > 0;
+    s.stride = ((s.width + 31) / 32) * 4;
+    return true;
+}
+
+bool bmp_stream_write(BmpStream &s, const uint8_t *data, size_t len)
+{
+    if (s.failed)
+        return false;
+
+    while (len > 0)
+    {
+        if (!s.header_done)
+        {
+            // First the fixed 14 + 40 bytes, then up to the pixel offset they declare
+            size_t need = s.pos < 54 ? 54 : s.pixel_offset;
+            size_t take = need - s.pos < len ? need - s.pos : len;
+            memcpy(s.header + s.pos, data, take);
+            s.pos += take;
+            data += take;
+            len -= take;
+            if (s.pos < need)
+                return true;
+
+            if (need == 54)
+            {
+                if (s.header[0] != 'B' || s.header[1] != 'M')
+                    return fail(s);
+                s.pixel_offset = read_u32(s.header + 10);
+                if (s.pixel_offset < 54 || s.pixel_offset > BMP_STREAM_HEADER_MAX)
+                    return fail(s);
+                if (s.pos < s.pixel_offset)
+                    continue;
+            }
+            if (!parse_header(s))
+                return fail(s);
+            s.header_done = true;
+            continue;
+        }
+
+        // Pixel data: copy the visible part of each BMP row into its panel row
+        size_t pixel = s.pos - s.pixel_offset;
+        size_t src_row = pixel / s.stride;
+        size_t col = pixel % s.stride;
+        if (src_row >= s.height)
+        {
+            // Trailing bytes are allowed only up to the declared file size
+            if (s.file_size && s.pos + len <= s.file_size)
+            {
+                s.pos += len;
+                return true;
+            }
+            return fail(s);
+        }
+
+        size_t take = s.stride - col < len ? s.stride - col : len;
+        size_t row_bytes = s.width / 8;
+        if (col < row_bytes)
+        {
+            size_t copy = row_bytes - col < take ? row_bytes - col : take;
+            size_t dst_row = s.bottom_up ? s.height - 1 - src_row : src_row;
+            memcpy(s.framebuffer + dst_row * row_bytes + col, data, copy);
+        }
+        s.pos += take;
+        data += take;
+        len -= take;
+        if (col + take == s.stride)
+            s.rows_written++;
+    }
+    return true;
+}
+
+bool bmp_stream_complete(const BmpStream &s)
+{
+    return !s.failed && s.header_done && s.rows_written == s.height;
+}
@@ -1,5 +1,4 @@
 #include "crypto.h"
-#include "mbedtls/aes.h"
 #include <cstring>
 
 bool aes256_cbc_decrypt(const uint8_t *key, const uint8_t *input, size_t input_len,
@@ -56,6 +55,246 @@ bool aes256_cbc_decrypt(const uint8_t *key, const uint8_t *input, size_t input_l
     return true;
 }
 
+size_t aes256_cbc_encrypted_size(size_t input_len)
+{
+    // PKCS7 always pads, a full block when the input is already aligned
+    return AES_IV_SIZE + (input_len / AES_BLOCK_SIZE + 1) * AES_BLOCK_SIZE;
+}
+
+bool aes256_cbc_encrypt(const uint8_t *key, const uint8_t *iv, const uint8_t *input, size_t input_len,
+                        uint8_t *output, size_t *output_len)
+{
+    if (!key || !iv || (!input && input_len) || !output || !output_len)
+        return false;
+
+    size_t full_len = input_len - input_len % AES_BLOCK_SIZE;
+    uint8_t last[AES_BLOCK_SIZE];
+    uint8_t pad_value = AES_BLOCK_SIZE - input_len % AES_BLOCK_SIZE;
+    if (input_len > full_len)
+        memcpy(last, input + full_len, input_len - full_len);
+    memset(last + (input_len - full_len), pad_value, pad_value);
+
+    // Copy IV since mbedtls_aes_crypt_cbc modifies it in-place
+    uint8_t chain[AES_IV_SIZE];
+    memcpy(chain, iv, AES_IV_SIZE);
+    memcpy(output, iv, AES_IV_SIZE);
+
+    mbedtls_aes_context ctx;
+    mbedtls_aes_init(&ctx);
+    int ret = mbedtls_aes_setkey_enc(&ctx, key, 256);
+    if (ret == 0 && full_len)
+        ret = mbedtls_aes_crypt_cbc(&ctx, MBEDTLS_AES_ENCRYPT, full_len, chain, input, output + AES_IV_SIZE);
+    if (ret == 0)
+        ret = mbedtls_aes_crypt_cbc(&ctx, MBEDTLS_AES_ENCRYPT, AES_BLOCK_SIZE, chain, last,
+                                    output + AES_IV_SIZE + full_len);
+    mbedtls_aes_free(&ctx);
+
+    if (ret != 0)
+        return false;
+    *output_len = AES_IV_SIZE + full_len + AES_BLOCK_SIZE;
+    return true;
+}
+
+bool aes256_cbc_stream_begin(Aes256CbcStream &s, const uint8_t *key)
+{
+    memset(&s, 0, sizeof(s));
+    mbedtls_aes_init(&s.aes);
+    if (!key || mbedtls_aes_setkey_dec(&s.aes, key, 256) != 0)
+    {
+        mbedtls_aes_free(&s.aes);
+        s.failed = true;
+        return false;
+    }
+    return true;
+}
+
+// Decrypt one full block; the previous block is released to the sink first
+static bool stream_block(Aes256CbcStream &s, const uint8_t *block, crypto_sink_fn sink, void *ctx)
+{
+    if (s.have_held && !sink(s.held, AES_BLOCK_SIZE, ctx))
+        return false;
+    if (mbedtls_aes_crypt_cbc(&s.aes, MBEDTLS_AES_DECRYPT, AES_BLOCK_SIZE, s.iv, block, s.held) != 0)
+        return false;
+    s.have_held = true;
+    return true;
+}
+
+bool aes256_cbc_stream_update(Aes256CbcStream &s, const uint8_t *input, size_t len,
+                              crypto_sink_fn sink, void *ctx)
+{
+    if (s.failed || !sink || (!input && len))
+        return false;
+
+    while (len > 0)
+    {
+        size_t take = AES_BLOCK_SIZE - s.partial_len;
+        if (take > len)
+            take = len;
+
+        // Whole block available and nothing buffered: decrypt straight from input
+        const uint8_t *block = nullptr;
+        if (s.partial_len == 0 && take == AES_BLOCK_SIZE)
+        {
+            block = input;
+        }
+        else
+        {
+            memcpy(s.partial + s.partial_len, input, take);
+            s.partial_len += take;
+            if (s.partial_len == AES_BLOCK_SIZE)
+            {
+                block = s.partial;
+                s.partial_len = 0;
+            }
+        }
+        input += take;
+        len -= take;
+
+        if (!block)
+            continue;
+        if (!s.have_iv)
+        {
+            memcpy(s.iv, block, AES_IV_SIZE);
+            s.have_iv = true;
+        }
+        else if (!stream_block(s, block, sink, ctx))
+        {
+            s.failed = true;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool aes256_cbc_stream_finish(Aes256CbcStream &s, crypto_sink_fn sink, void *ctx)
+{
+    bool ok = !s.failed && sink && s.have_held && s.partial_len == 0;
+
+    // PKCS7 unpadding of the held-back final block
+    uint8_t pad_value = ok ? s.held[AES_BLOCK_SIZE - 1] : 0;
+    if (pad_value == 0 || pad_value > AES_BLOCK_SIZE)
+        ok = false;
+    for (uint8_t i = 0; ok && i < pad_value; i++)
+    {
+        if (s.held[AES_BLOCK_SIZE - 1 - i] != pad_value)
+            ok = false;
+    }
+    if (ok && pad_value < AES_BLOCK_SIZE)
+        ok = sink(s.held, AES_BLOCK_SIZE - pad_value, ctx);
+
+    aes256_cbc_stream_abort(s);
+    return ok;
+}
+
+void aes256_cbc_stream_abort(Aes256CbcStream &s)
+{
+    mbedtls_aes_free(&s.aes);
+    memset(s.held, 0, sizeof(s.held));
+    s.have_held = false;
+    s.failed = true;
+}
+
+// Decrypt the plaintext window starting at block `first` into r.window
+static bool reader_fill(Aes256CbcReader &r, size_t first)
+{
+    size_t start = first * AES_BLOCK_SIZE;
+    size_t len = r.cipher_len - start;
+    if (len > AES_READER_WINDOW)
+        len = AES_READER_WINDOW;
+
+    // [previous block or IV][ciphertext blocks] sit contiguously in the file
+    if (!r.fetch(start, r.scratch, AES_IV_SIZE + len, r.ctx))
+        return false;
+    if (mbedtls_aes_crypt_cbc(&r.aes, MBEDTLS_AES_DECRYPT, len, r.scratch,
+                              r.scratch + AES_IV_SIZE, r.window) != 0)
+        return false;
+
+    r.window_start = start;
+    r.window_len = len;
+    return true;
+}
+
+bool aes256_cbc_reader_open(Aes256CbcReader &r, const uint8_t *key, size_t input_len,
+                            crypto_fetch_fn fetch, void *ctx)
+{
+    memset(&r, 0, sizeof(r));
+    if (!key || !fetch || input_len < AES_IV_SIZE + AES_BLOCK_SIZE ||
+        (input_len - AES_IV_SIZE) % AES_BLOCK_SIZE != 0)
+        return false;
+
+    mbedtls_aes_init(&r.aes);
+    if (mbedtls_aes_setkey_dec(&r.aes, key, 256) != 0)
+    {
+        mbedtls_aes_free(&r.aes);
+        return false;
+    }
+    r.fetch = fetch;
+    r.ctx = ctx;
+
+    // Last block carries the padding
+    uint8_t tail[2 * AES_BLOCK_SIZE];
+    uint8_t last[AES_BLOCK_SIZE];
+    if (!fetch(input_len - sizeof(tail), tail, sizeof(tail), ctx) ||
+        mbedtls_aes_crypt_cbc(&r.aes, MBEDTLS_AES_DECRYPT, AES_BLOCK_SIZE, tail,
+                              tail + AES_BLOCK_SIZE, last) != 0)
+    {
+        mbedtls_aes_free(&r.aes);
+        return false;
+    }
+
+    uint8_t pad_value = last[AES_BLOCK_SIZE - 1];
+    bool ok = pad_value > 0 && pad_value <= AES_BLOCK_SIZE;
+    for (uint8_t i = 0; ok && i < pad_value; i++)
+    {
+        if (last[AES_BLOCK_SIZE - 1 - i] != pad_value)
+            ok = false;
+    }
+    if (!ok)
+    {
+        mbedtls_aes_free(&r.aes);
+        return false;
+    }
+
+    r.cipher_len = input_len - AES_IV_SIZE;
+    r.plain_len = r.cipher_len - pad_value;
+    return true;
+}
+
+int32_t aes256_cbc_reader_read(Aes256CbcReader &r, size_t pos, uint8_t *out, size_t len)
+{
+    if (!r.fetch || !out)
+        return -1;
+    if (pos >= r.plain_len)
+        return 0;
+    if (len > r.plain_len - pos)
+        len = r.plain_len - pos;
+
+    size_t done = 0;
+    while (done < len)
+    {
+        size_t at = pos + done;
+        if (r.window_len == 0 || at < r.window_start || at >= r.window_start + r.window_len)
+        {
+            if (!reader_fill(r, at / AES_BLOCK_SIZE))
+                return -1;
+        }
+        size_t offset = at - r.window_start;
+        size_t n = r.window_len - offset;
+        if (n > len - done)
+            n = len - done;
+        memcpy(out + done, r.window + offset, n);
+        done += n;
+    }
+    return (int32_t)done;
+}
+
+void aes256_cbc_reader_close(Aes256CbcReader &r)
+{
+    if (r.fetch)
+        mbedtls_aes_free(&r.aes);
+    memset(&r, 0, sizeof(r));
+}
+
 static uint8_t hex_char_to_nibble(char c)
 {
     if (c >= '0' && c <= '9') return c - '0';
@@ -0,0 +1,166 @@
+#include "delta.h"
+#include <cstring>
+
+static bool read_varint(const uint8_t *data, size_t len, size_t *pos, uint32_t *out)
+{
+    uint32_t value = 0;
+    for (int shift = 0; shift < 32; shift += 7)
+    {
+        if (*pos >= len)
+            return false;
+        uint8_t b = data[(*pos)++];
+        value |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+        {
+            *out = value;
+            return true;
+        }
+    }
+    return false;  // more than 5 bytes — corrupt
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+bool delta_parse_header(const uint8_t *delta, size_t len, DeltaHeader &out)
+{
+    if (!delta || len < DELTA_HEADER_SIZE)
+        return false;
+    if (memcmp(delta, DELTA_MAGIC, 4) != 0 || delta[4] != DELTA_VERSION)
+        return false;
+
+    memcpy(out.base_hash, delta + 8, FRAME_HASH_SIZE);
+    memcpy(out.target_hash, delta + 16, FRAME_HASH_SIZE);
+    out.target_size = (uint32_t)delta[24] | ((uint32_t)delta[25] << 8) |
+                      ((uint32_t)delta[26] << 16) | ((uint32_t)delta[27] << 24);
+
+    out.has_rects = (delta[5] & DELTA_FLAG_RECTS) != 0;
+    out.rect_count = 0;
+    out.ops_offset = DELTA_HEADER_SIZE;
+    if (out.has_rects)
+    {
+        if (len < DELTA_HEADER_SIZE + 1)
+            return false;
+        uint8_t count = delta[DELTA_HEADER_SIZE];
+        size_t table = DELTA_HEADER_SIZE + 1;
+        if (count > DELTA_MAX_RECTS || len < table + (size_t)count * 8)
+            return false;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const uint8_t *r = delta + table + i * 8;
+            out.rects[i].x = read_u16(r);
+            out.rects[i].y = read_u16(r + 2);
+            out.rects[i].w = read_u16(r + 4);
+            out.rects[i].h = read_u16(r + 6);
+        }
+        out.rect_count = count;
+        out.ops_offset = table + (size_t)count * 8;
+    }
+    return true;
+}
+
+uint32_t delta_rect_area(const DeltaHeader &header)
+{
+    uint32_t area = 0;
+    for (uint8_t i = 0; i < header.rect_count; i++)
+        area += (uint32_t)header.rects[i].w * header.rects[i].h;
+    return area;
+}
+
+bool delta_for_each_run(const uint8_t *delta, size_t delta_len, delta_run_fn fn, void *ctx)
+{
+    DeltaHeader header;
+    if (!delta_parse_header(delta, delta_len, header))
+        return false;
+
+    size_t target = header.target_size;
+    size_t pos = header.ops_offset;
+    size_t out = 0;
+    while (pos < delta_len)
+    {
+        uint32_t skip, run;
+        if (!read_varint(delta, delta_len, &pos, &skip) ||
+            !read_varint(delta, delta_len, &pos, &run))
+            return false;
+        if (skip > target - out || run > target - out - skip || run > delta_len - pos)
+            return false;
+
+        out += skip;
+        if (fn)
+            fn(out, delta + pos, run, ctx);
+        out += run;
+        pos += run;
+    }
+    return true;
+}
+
+static void xor_run(size_t offset, const uint8_t *bytes, size_t len, void *ctx)
+{
+    uint8_t *frame = (uint8_t *)ctx;
+    for (size_t i = 0; i < len; i++)
+        frame[offset + i] ^= bytes[i];
+}
+
+bool delta_apply(const uint8_t *delta, size_t delta_len,
+                 uint8_t *frame, size_t frame_cap, size_t *frame_len)
+{
+    if (!frame || !frame_len)
+        return false;
+
+    DeltaHeader header;
+    if (!delta_parse_header(delta, delta_len, header))
+        return false;
+    if (header.target_size > frame_cap)
+        return false;
+
+    // Validate every op before touching the frame
+    if (!delta_for_each_run(delta, delta_len, nullptr, nullptr))
+        return false;
+
+    // Base is zero-extended (or truncated) to the target size before XOR
+    if (header.target_size > *frame_len)
+        memset(frame + *frame_len, 0, header.target_size - *frame_len);
+
+    delta_for_each_run(delta, delta_len, xor_run, frame);
+    *frame_len = header.target_size;
+    return true;
+}
+
+void frame_hash(const uint8_t *data, size_t len, uint8_t *out)
+{
+    uint8_t digest[32];
+    mbedtls_sha256(data, len, digest, 0);
+    memcpy(out, digest, FRAME_HASH_SIZE);
+}
+
+void frame_hash_begin(FrameHasher &h)
+{
+    mbedtls_sha256_init(&h.sha);
+    mbedtls_sha256_starts(&h.sha, 0);
+}
+
+void frame_hash_update(FrameHasher &h, const uint8_t *data, size_t len)
+{
+    mbedtls_sha256_update(&h.sha, data, len);
+}
+
+void frame_hash_finish(FrameHasher &h, uint8_t *out)
+{
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&h.sha, digest);
+    mbedtls_sha256_free(&h.sha);
+    memcpy(out, digest, FRAME_HASH_SIZE);
+}
+
+void frame_hash_to_hex(const uint8_t *hash, char *out)
+{
+    static const char hex[] = "0123456789abcdef";
+    for (int i = 0; i < FRAME_HASH_SIZE; i++)
+    {
+        out[i * 2] = hex[hash[i] >> 4];
+        out[i * 2 + 1] = hex[hash[i] & 0x0F];
+    }
+    out[FRAME_HASH_SIZE * 2] = '\0';
+}
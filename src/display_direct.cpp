@@ -0,0 +1,194 @@
+#include "display_direct.h"
+#include <Arduino.h>
+#include <bmp.h>
+#include <trmnl_log.h>
+#include "delta.h"
+
+// FastEPD and multi-colour panels have no old/new plane pair to drive
+#if defined(BOARD_TRMNL_X) || defined(BOARD_TRMNL_4CLR) || \
+    defined(BOARD_XIAO_EPAPER_DISPLAY_3CLR) || defined(BOARD_SEEED_RETERMINAL_E1002)
+#define DISPLAY_DIRECT_UNSUPPORTED
+#endif
+
+#ifndef DISPLAY_DIRECT_UNSUPPORTED
+#include <bb_epaper.h>
+#include <soc/soc_memory_layout.h>
+extern BBEPAPER bbep;  // owned by display.cpp
+
+#define PANEL_WIDTH_BYTES (DISPLAY_DIRECT_WIDTH / 8)
+#define PANEL_HEIGHT DISPLAY_DIRECT_HEIGHT
+#define PANEL_FRAME_BYTES DISPLAY_DIRECT_FRAME_BYTES
+
+// dpList in display.cpp: 1-bit and 4-gray panel type per display profile
+// (0 = default, 1 = "a", 2 = "b"). The 4.26" XTEINK panel has no entry there.
+#ifndef BOARD_XTEINK_X4
+#define DISPLAY_DIRECT_GRAY
+static int one_bit_panel(uint32_t profile)
+{
+    return profile == 1 ? EP75_800x480_GEN2 : EP75_800x480;
+}
+
+static int gray_panel(uint32_t profile)
+{
+    switch (profile)
+    {
+    case 1:  return EP75_800x480_4GRAY_GEN2;
+    case 2:  return EP75_800x480_4GRAY_V2;
+    default: return EP75_800x480_4GRAY;
+    }
+}
+#endif
+
+struct UndoContext
+{
+    uint8_t *framebuffer;
+    size_t pixel_offset;  // BMP pixel array start within the file
+};
+
+// Delta runs are in BMP file offsets (bottom-up rows); the framebuffer is top-down
+static void undo_run(size_t offset, const uint8_t *bytes, size_t len, void *ctx)
+{
+    UndoContext *undo = (UndoContext *)ctx;
+    for (size_t i = 0; i < len; i++)
+    {
+        size_t pos = offset + i;
+        if (pos < undo->pixel_offset || pos >= undo->pixel_offset + PANEL_FRAME_BYTES)
+            continue;  // header / palette bytes
+        size_t pixel = pos - undo->pixel_offset;
+        size_t row = PANEL_HEIGHT - 1 - pixel / PANEL_WIDTH_BYTES;
+        undo->framebuffer[row * PANEL_WIDTH_BYTES + pixel % PANEL_WIDTH_BYTES] ^= bytes[i];
+    }
+}
+#endif
+
+bool display_direct_supported()
+{
+#ifdef DISPLAY_DIRECT_UNSUPPORTED
+    return false;
+#else
+    return true;
+#endif
+}
+
+bool display_show_bmp_delta(const uint8_t *bmp, size_t bmp_len,
+                            const uint8_t *delta, size_t delta_len, uint8_t *scratch)
+{
+#ifdef DISPLAY_DIRECT_UNSUPPORTED
+    return false;
+#else
+    bool image_reverse = false;
+    if (bmp_len < 14 || parseBMPHeader(const_cast<uint8_t *>(bmp), image_reverse) != BMP_NO_ERR)
+        return false;
+
+    size_t pixel_offset = (size_t)bmp[10] | ((size_t)bmp[11] << 8) |
+                          ((size_t)bmp[12] << 16) | ((size_t)bmp[13] << 24);
+    if (pixel_offset + PANEL_FRAME_BYTES > bmp_len)
+        return false;
+
+    uint8_t *framebuffer = scratch;
+    if (!framebuffer)
+        return false;
+
+    // New frame, flipped to top-down
+    for (int y = 0; y < PANEL_HEIGHT; y++)
+        memcpy(framebuffer + y * PANEL_WIDTH_BYTES,
+               bmp + pixel_offset + (PANEL_HEIGHT - 1 - y) * PANEL_WIDTH_BYTES, PANEL_WIDTH_BYTES);
+
+    uint8_t *saved_buffer = bbep.getBuffer();
+    bbep.setBuffer(framebuffer);
+    bbep.writePlane(PLANE_0, image_reverse);
+
+    // Old frame = new XOR delta; validated run by run, so a bad delta leaves
+    // the panel untouched
+    UndoContext undo = {framebuffer, pixel_offset};
+    bool ok = delta_for_each_run(delta, delta_len, undo_run, &undo);
+    if (ok)
+    {
+        bbep.writePlane(PLANE_1, image_reverse);
+        bbep.refresh(REFRESH_PARTIAL, true);
+    }
+
+    bbep.setBuffer(saved_buffer);
+    return ok;
+#endif
+}
+
+uint8_t *display_direct_framebuffer()
+{
+#ifdef DISPLAY_DIRECT_UNSUPPORTED
+    return nullptr;
+#else
+    // After display_show_image() of a BMP, bbep can still point into that
+    // image — possibly a logo in flash — so only hand out a RAM buffer
+    uint8_t *buffer = bbep.getBuffer();
+    if (!buffer || !(esp_ptr_in_dram(buffer) || esp_ptr_external_ram(buffer)))
+        return nullptr;
+    return buffer;
+#endif
+}
+
+bool display_show_framebuffer(uint8_t *framebuffer, bool invert, PanelRefresh mode)
+{
+#ifdef DISPLAY_DIRECT_UNSUPPORTED
+    return false;
+#else
+    if (!framebuffer)
+        return false;
+    uint8_t *saved_buffer = bbep.getBuffer();
+    if (framebuffer != saved_buffer)
+        bbep.setBuffer(framebuffer);
+
+    // As display_show_image() does for a 1-bpp frame: a partial writes only the
+    // new plane, full and fast load both so there is no stale diff
+    if (mode == PANEL_REFRESH_PARTIAL)
+    {
+        bbep.writePlane(PLANE_0, invert);
+        bbep.refresh(REFRESH_PARTIAL, true);
+    }
+    else
+    {
+        bbep.writePlane(PLANE_DUPLICATE, invert);
+        bbep.refresh(mode == PANEL_REFRESH_FAST ? REFRESH_FAST : REFRESH_FULL, true);
+    }
+
+    if (framebuffer != saved_buffer)
+        bbep.setBuffer(saved_buffer);
+    return true;
+#endif
+}
+
+bool display_gray_supported()
+{
+#ifdef DISPLAY_DIRECT_GRAY
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool display_show_gray(uint8_t *framebuffer, uint32_t temp_profile, display_fill_fn fill_low, void *ctx)
+{
+#ifndef DISPLAY_DIRECT_GRAY
+    return false;
+#else
+    if (!framebuffer || !fill_low)
+        return false;
+    uint8_t *saved_buffer = bbep.getBuffer();
+    if (framebuffer != saved_buffer)
+        bbep.setBuffer(framebuffer);
+
+    bbep.setPanelType(gray_panel(temp_profile));
+    bbep.writePlane(PLANE_1, false);
+    bool ok = fill_low(framebuffer, ctx);
+    if (ok)
+    {
+        bbep.writePlane(PLANE_0, false);
+        bbep.refresh(REFRESH_FULL, true);
+    }
+    bbep.setPanelType(one_bit_panel(temp_profile));
+
+    if (framebuffer != saved_buffer)
+        bbep.setBuffer(saved_buffer);
+    return ok;
+#endif
+}
@@ -0,0 +1,445 @@
+#include "frame_cache.h"
+#include "image_store.h"
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <trmnl_log.h>
+
+// Frames go to the raw image store when the partition table has one, else to
+// SPIFFS files (boards still on plain min_spiffs.csv).
+//
+// File layout: [2 magic "FC"][1 version][1 reserved][8 hash][4 size LE][frame]
+#define FRAME_CACHE_VERSION 1
+#define FRAME_CACHE_HEADER_SIZE 16
+
+// The SPIFFS partition on min_spiffs.csv is only 128 KB and also holds the
+// PNG/JPEG download spool, so cache files are evicted least recently used
+// first to make room, and a write that still doesn't fit is skipped instead
+// of being written, failing and removed again on every wake. SPIFFS needs a
+// few free pages for garbage collection, hence the slack.
+#define FRAME_CACHE_SPIFFS_SLACK 8192
+#define FRAME_CACHE_USE_ENTRIES 16
+
+struct CacheUse
+{
+    uint32_t key;
+    uint32_t seq;  // 0 = unused
+};
+
+// Last use per screen key; files not listed here (e.g. after power loss) go first
+RTC_DATA_ATTR static CacheUse rtc_use[FRAME_CACHE_USE_ENTRIES];
+RTC_DATA_ATTR static uint32_t rtc_use_seq;
+
+static bool mounted = false;
+
+// State of the single streamed write (frame_cache_begin / append / commit)
+static bool stream_to_store = false;
+static File stream_file;
+static char stream_path[16];
+static uint8_t stream_hash[FRAME_HASH_SIZE];
+static size_t stream_expected = 0;
+static size_t stream_written = 0;
+
+static bool cache_mount()
+{
+    if (mounted)
+        return true;
+    // Format on first use. The partition holds cached frames (/fc_*) and the
+    // PNG/JPEG download spool (/img_spool, image_stream.cpp); both are
+    // disposable, so losing them to a format only costs a re-download
+    mounted = SPIFFS.begin(true);
+    if (!mounted)
+        Log_error("Frame cache: SPIFFS mount failed");
+    return mounted;
+}
+
+static uint32_t screen_key(const char *screen_name)
+{
+    uint32_t h = 2166136261u;  // FNV-1a
+    for (const char *p = screen_name; *p; p++)
+    {
+        h ^= (uint8_t)*p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// SPIFFS names are limited to 32 chars; screen names are free-form, so hash them
+static void cache_path(const char *screen_name, char *out, size_t out_len)
+{
+    snprintf(out, out_len, "/fc_%08x", screen_key(screen_name));
+}
+
+// ---- SPIFFS space ----
+
+static void touch(uint32_t key)
+{
+    CacheUse *slot = &rtc_use[0];
+    for (CacheUse &u : rtc_use)
+    {
+        if (u.seq != 0 && u.key == key)
+        {
+            slot = &u;
+            break;
+        }
+        if (u.seq < slot->seq)
+            slot = &u;
+    }
+    slot->key = key;
+    slot->seq = ++rtc_use_seq;
+}
+
+static uint32_t last_use(uint32_t key)
+{
+    for (const CacheUse &u : rtc_use)
+        if (u.seq != 0 && u.key == key)
+            return u.seq;
+    return 0;
+}
+
+static size_t spiffs_free()
+{
+    size_t total = SPIFFS.totalBytes();
+    size_t used = SPIFFS.usedBytes();
+    return used < total ? total - used : 0;
+}
+
+// Remove the least recently used cache file other than keep_path
+static bool evict_one(const char *keep_path)
+{
+    char victim[16] = "";
+    uint32_t victim_seq = UINT32_MAX;
+
+    File root = SPIFFS.open("/");
+    for (File f = root.openNextFile(); f; f = root.openNextFile())
+    {
+        const char *path = f.path();
+        if (strncmp(path, "/fc_", 4) != 0 || strlen(path) >= sizeof(victim) ||
+            (keep_path && strcmp(path, keep_path) == 0))
+            continue;
+        uint32_t seq = last_use((uint32_t)strtoul(path + 4, nullptr, 16));
+        if (seq < victim_seq)
+        {
+            victim_seq = seq;
+            strcpy(victim, path);
+        }
+    }
+    root.close();
+
+    if (!victim[0])
+        return false;
+    Log_info("Frame cache: evicting %s to free flash", victim);
+    return SPIFFS.remove(victim);
+}
+
+// Evict until `bytes` plus the slack are free; false if the cache can't give enough
+static bool spiffs_make_room(size_t bytes, const char *keep_path)
+{
+    while (spiffs_free() < bytes + FRAME_CACHE_SPIFFS_SLACK)
+    {
+        if (!evict_one(keep_path))
+            return false;
+    }
+    return true;
+}
+
+// Drop the old entry (it is being replaced anyway) and make room for the new one
+static bool spiffs_prepare_write(const char *path, size_t len)
+{
+    if (SPIFFS.exists(path))
+        SPIFFS.remove(path);
+    if (spiffs_make_room(FRAME_CACHE_HEADER_SIZE + len, path))
+        return true;
+    Log_info("Frame cache: %d bytes don't fit in SPIFFS (%d free), not caching %s",
+             len, spiffs_free(), path);
+    return false;
+}
+
+static bool read_header(File &f, uint8_t *hash_out, size_t *size_out)
+{
+    uint8_t header[FRAME_CACHE_HEADER_SIZE];
+    if (f.read(header, sizeof(header)) != sizeof(header))
+        return false;
+    if (header[0] != 'F' || header[1] != 'C' || header[2] != FRAME_CACHE_VERSION)
+        return false;
+
+    memcpy(hash_out, header + 4, FRAME_HASH_SIZE);
+    *size_out = (size_t)header[12] | ((size_t)header[13] << 8) |
+                ((size_t)header[14] << 16) | ((size_t)header[15] << 24);
+    return *size_out + FRAME_CACHE_HEADER_SIZE == f.size();
+}
+
+bool frame_cache_peek(const char *screen_name, uint8_t *hash_out, size_t *size_out)
+{
+    if (!screen_name || !hash_out || !size_out)
+        return false;
+
+    if (image_store_init())
+    {
+        ImageSlotHeader h;
+        if (!image_store_lookup(screen_key(screen_name), h))
+            return false;
+        memcpy(hash_out, h.hash, FRAME_HASH_SIZE);
+        *size_out = h.size;
+        return true;
+    }
+
+    if (!cache_mount())
+        return false;
+
+    char path[16];
+    cache_path(screen_name, path, sizeof(path));
+    if (!SPIFFS.exists(path))
+        return false;
+
+    File f = SPIFFS.open(path, "r");
+    if (!f)
+        return false;
+    bool ok = read_header(f, hash_out, size_out);
+    f.close();
+    return ok;
+}
+
+const uint8_t *frame_cache_map(const char *screen_name, size_t *size_out)
+{
+    if (!screen_name || !size_out || !image_store_init())
+        return nullptr;
+    return image_store_map(screen_key(screen_name), size_out);
+}
+
+bool frame_cache_read(const char *screen_name, uint8_t *buffer, size_t capacity, size_t *size_out)
+{
+    if (!screen_name || !buffer || !size_out)
+        return false;
+
+    if (image_store_init())
+    {
+        size_t size = 0;
+        const uint8_t *mapped = frame_cache_map(screen_name, &size);
+        if (!mapped || size > capacity)
+            return false;
+        memcpy(buffer, mapped, size);
+        *size_out = size;
+        touch(screen_key(screen_name));
+        return true;
+    }
+
+    if (!cache_mount())
+        return false;
+
+    char path[16];
+    cache_path(screen_name, path, sizeof(path));
+    File f = SPIFFS.open(path, "r");
+    if (!f)
+        return false;
+
+    uint8_t hash[FRAME_HASH_SIZE];
+    size_t size = 0;
+    bool ok = read_header(f, hash, &size) && size <= capacity &&
+              f.read(buffer, size) == size;
+    f.close();
+
+    if (!ok)
+    {
+        Log_error("Frame cache: %s unreadable", path);
+        return false;
+    }
+    *size_out = size;
+    touch(screen_key(screen_name));
+    return true;
+}
+
+static void fill_header(uint8_t *header, const uint8_t *hash, size_t len)
+{
+    memset(header, 0, FRAME_CACHE_HEADER_SIZE);
+    header[0] = 'F';
+    header[1] = 'C';
+    header[2] = FRAME_CACHE_VERSION;
+    memcpy(header + 4, hash, FRAME_HASH_SIZE);
+    header[12] = len & 0xFF;
+    header[13] = (len >> 8) & 0xFF;
+    header[14] = (len >> 16) & 0xFF;
+    header[15] = (len >> 24) & 0xFF;
+}
+
+bool frame_cache_store(const char *screen_name, const uint8_t *data, size_t len)
+{
+    if (!screen_name || !data || len == 0)
+        return false;
+    if (!image_store_init() && !cache_mount())
+        return false;
+
+    uint8_t hash[FRAME_HASH_SIZE];
+    frame_hash(data, len, hash);
+
+    // Unchanged frame — don't spend a flash erase/write on it
+    uint8_t cached_hash[FRAME_HASH_SIZE];
+    size_t cached_size = 0;
+    if (frame_cache_peek(screen_name, cached_hash, &cached_size) &&
+        cached_size == len && memcmp(hash, cached_hash, FRAME_HASH_SIZE) == 0)
+        return true;
+
+    if (image_store_init())
+        return image_store_begin(screen_key(screen_name), hash, len) &&
+               image_store_append(data, len) && image_store_commit();
+
+    char path[16];
+    cache_path(screen_name, path, sizeof(path));
+
+    if (!spiffs_prepare_write(path, len))
+        return false;
+
+    uint8_t header[FRAME_CACHE_HEADER_SIZE];
+    fill_header(header, hash, len);
+
+    File f = SPIFFS.open(path, "w");
+    if (!f)
+    {
+        Log_error("Frame cache: cannot open %s for write", path);
+        return false;
+    }
+    bool ok = f.write(header, sizeof(header)) == sizeof(header) &&
+              f.write(data, len) == len;
+    f.close();
+
+    if (!ok)
+    {
+        // Partial file would fail the size check on read, but don't leave it around
+        Log_error("Frame cache: write failed for %s (%d bytes)", path, len);
+        SPIFFS.remove(path);
+        return false;
+    }
+
+    touch(screen_key(screen_name));
+    char hex[FRAME_HASH_HEX_SIZE];
+    frame_hash_to_hex(hash, hex);
+    Log_info("Frame cache: stored %s as %s (%d bytes)", screen_name, hex, len);
+    return true;
+}
+
+bool frame_cache_begin(const char *screen_name, const uint8_t *hash, size_t len)
+{
+    if (!screen_name || !hash || len == 0)
+        return false;
+    if (!image_store_init() && !cache_mount())
+        return false;
+    frame_cache_abort();
+
+    // Already cached — nothing to write
+    uint8_t cached_hash[FRAME_HASH_SIZE];
+    size_t cached_size = 0;
+    if (frame_cache_peek(screen_name, cached_hash, &cached_size) &&
+        cached_size == len && memcmp(hash, cached_hash, FRAME_HASH_SIZE) == 0)
+        return false;
+
+    cache_path(screen_name, stream_path, sizeof(stream_path));
+    if (image_store_init())
+    {
+        stream_to_store = image_store_begin(screen_key(screen_name), hash, len);
+        if (stream_to_store)
+        {
+            memcpy(stream_hash, hash, FRAME_HASH_SIZE);
+            stream_expected = len;
+            stream_written = 0;
+        }
+        return stream_to_store;
+    }
+
+    if (!spiffs_prepare_write(stream_path, len))
+        return false;
+
+    stream_file = SPIFFS.open(stream_path, "w");
+    if (!stream_file)
+    {
+        Log_error("Frame cache: cannot open %s for write", stream_path);
+        return false;
+    }
+
+    uint8_t header[FRAME_CACHE_HEADER_SIZE];
+    fill_header(header, hash, len);
+    if (stream_file.write(header, sizeof(header)) != sizeof(header))
+    {
+        frame_cache_abort();
+        return false;
+    }
+    memcpy(stream_hash, hash, FRAME_HASH_SIZE);
+    stream_expected = len;
+    stream_written = 0;
+    return true;
+}
+
+bool frame_cache_append(const uint8_t *data, size_t len)
+{
+    if (stream_to_store)
+    {
+        if (image_store_append(data, len))
+        {
+            stream_written += len;
+            return true;
+        }
+        stream_to_store = false;  // image_store_append() already gave up the slot
+        return false;
+    }
+    if (!stream_file)
+        return false;
+    if (stream_written + len > stream_expected || stream_file.write(data, len) != len)
+    {
+        Log_error("Frame cache: streamed write failed for %s", stream_path);
+        frame_cache_abort();
+        return false;
+    }
+    stream_written += len;
+    return true;
+}
+
+bool frame_cache_commit(const uint8_t *hash)
+{
+    if (!stream_file && !stream_to_store)
+        return false;
+    if (stream_written != stream_expected || !hash || memcmp(hash, stream_hash, FRAME_HASH_SIZE) != 0)
+    {
+        Log_error("Frame cache: streamed frame for %s incomplete or hash mismatch", stream_path);
+        frame_cache_abort();
+        return false;
+    }
+    if (stream_to_store)
+    {
+        stream_to_store = false;
+        if (!image_store_commit())
+            return false;
+    }
+    else
+    {
+        stream_file.close();
+    }
+    touch((uint32_t)strtoul(stream_path + 4, nullptr, 16));
+
+    char hex[FRAME_HASH_HEX_SIZE];
+    frame_hash_to_hex(hash, hex);
+    Log_info("Frame cache: stored %s as %s (%d bytes, streamed)", stream_path, hex, stream_written);
+    return true;
+}
+
+void frame_cache_abort()
+{
+    if (stream_to_store)
+    {
+        stream_to_store = false;
+        image_store_abort();
+        return;
+    }
+    if (!stream_file)
+        return;
+    // A partial file fails the size check on read, but don't leave it around
+    stream_file.close();
+    SPIFFS.remove(stream_path);
+}
+
+bool frame_cache_make_room(size_t bytes)
+{
+    if (!cache_mount())
+        return false;
+    if (spiffs_make_room(bytes, nullptr))
+        return true;
+    Log_error("Frame cache: cannot free %d bytes of SPIFFS (%d free)", bytes, spiffs_free());
+    return false;
+}
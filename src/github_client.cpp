@@ -3,44 +3,62 @@
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <trmnl_log.h>
-#include <esp_heap_caps.h>
 
-uint8_t *https_download(const char *url, size_t *out_size)
+#define STREAM_CHUNK_SIZE 1024  // stack buffer for https_download_stream()
+#define STREAM_STALL_MS 5000
+
+static uint32_t request_timeout_ms = HTTPS_TIMEOUT_MS;
+static uint32_t last_latency_ms = 0;
+
+void https_set_timeout(uint32_t timeout_ms)
 {
-    if (!url || !out_size)
-        return nullptr;
+    request_timeout_ms = timeout_ms ? timeout_ms : HTTPS_TIMEOUT_MS;
+}
 
-    *out_size = 0;
+uint32_t https_last_latency_ms()
+{
+    return last_latency_ms;
+}
 
+static void close_connection(HTTPClient &https, WiFiClientSecure *client)
+{
+    https.end();
+    client->stop();
+    delete client;
+}
+
+// Connect and issue the GET. Returns the content length (> 0) with the
+// connection open, or 0 with everything already cleaned up.
+static int begin_get(HTTPClient &https, WiFiClientSecure **client_out, const char *url)
+{
     WiFiClientSecure *client = new WiFiClientSecure();
     if (!client)
     {
         Log_error("Failed to create WiFiClientSecure");
-        return nullptr;
+        return 0;
     }
     client->setInsecure(); // TODO: pin GitHub Pages root CA cert
 
-    HTTPClient https;
     if (!https.begin(*client, url))
     {
         Log_error("HTTPClient begin failed for %s", url);
         delete client;
-        return nullptr;
+        return 0;
     }
 
-    https.setTimeout(15000);
-    https.setConnectTimeout(15000);
+    https.setTimeout(request_timeout_ms);
+    https.setConnectTimeout(request_timeout_ms);
     https.setReuse(false);
 
+    unsigned long request_start = millis();
     int httpCode = https.GET();
+    last_latency_ms = millis() - request_start;
 
     if (httpCode != HTTP_CODE_OK)
     {
         Log_error("HTTP GET failed: %d %s", httpCode, https.errorToString(httpCode).c_str());
-        https.end();
-        client->stop();
-        delete client;
-        return nullptr;
+        close_connection(https, client);
+        return 0;
     }
 
     int content_size = https.getSize();
@@ -49,25 +67,34 @@ uint8_t *https_download(const char *url, size_t *out_size)
     if (content_size <= 0)
     {
         Log_error("Invalid content size %d from %s", content_size, url);
-        https.end();
-        client->stop();
-        delete client;
-        return nullptr;
+        close_connection(https, client);
+        return 0;
     }
 
-    // Allocate output buffer first — in PSRAM if available, else regular heap
-    uint8_t *buffer = (uint8_t *)heap_caps_malloc(content_size, MALLOC_CAP_SPIRAM);
-    if (!buffer)
-    {
-        Log_info("PSRAM alloc failed, trying regular heap");
-        buffer = (uint8_t *)malloc(content_size);
-    }
+    *client_out = client;
+    return content_size;
+}
+
+uint8_t *https_download(const char *url, size_t *out_size, Arena &arena)
+{
+    if (!url || !out_size)
+        return nullptr;
+
+    *out_size = 0;
+
+    HTTPClient https;
+    WiFiClientSecure *client = nullptr;
+    int content_size = begin_get(https, &client, url);
+    if (content_size <= 0)
+        return nullptr;
+
+    // Allocate output buffer first, from the caller's arena
+    uint8_t *buffer = (uint8_t *)arena_alloc(arena, content_size);
     if (!buffer)
     {
-        Log_error("Failed to allocate %d bytes for download buffer", content_size);
-        https.end();
-        client->stop();
-        delete client;
+        Log_error("Failed to allocate %d bytes for download buffer (arena %d/%d used)",
+                  content_size, arena.used, arena.capacity);
+        close_connection(https, client);
         return nullptr;
     }
 
@@ -85,7 +112,7 @@ uint8_t *https_download(const char *url, size_t *out_size)
             bytes_read += got;
             last_data_ms = millis();  // reset idle timer on any data
         }
-        else if (millis() - last_data_ms > 5000)
+        else if (millis() - last_data_ms > STREAM_STALL_MS)
         {
             Log_error("Stream stalled — no data for 5s (%d/%d bytes)", bytes_read, content_size);
             break;
@@ -96,14 +123,11 @@ uint8_t *https_download(const char *url, size_t *out_size)
         }
     }
 
-    https.end();
-    client->stop();
-    delete client;
+    close_connection(https, client);
 
     if (bytes_read == 0)
     {
         Log_error("Empty response from %s", url);
-        free(buffer);
         return nullptr;
     }
 
@@ -111,3 +135,64 @@ uint8_t *https_download(const char *url, size_t *out_size)
     Log_info("Downloaded %d bytes from %s", bytes_read, url);
     return buffer;
 }
+
+bool https_download_stream(const char *url, https_chunk_fn on_chunk, void *ctx, size_t *out_size)
+{
+    if (!url || !on_chunk || !out_size)
+        return false;
+
+    *out_size = 0;
+
+    HTTPClient https;
+    WiFiClientSecure *client = nullptr;
+    int content_size = begin_get(https, &client, url);
+    if (content_size <= 0)
+        return false;
+
+    uint8_t chunk[STREAM_CHUNK_SIZE];
+    WiFiClient *stream = https.getStreamPtr();
+    size_t bytes_read = 0;
+    bool aborted = false;
+    unsigned long last_data_ms = millis();
+    while (bytes_read < (size_t)content_size && stream->connected())
+    {
+        size_t available = stream->available();
+        if (available)
+        {
+            size_t to_read = min(min(available, sizeof(chunk)), (size_t)content_size - bytes_read);
+            size_t got = stream->readBytes(chunk, to_read);
+            bytes_read += got;
+            last_data_ms = millis();
+            if (got && !on_chunk(chunk, got, ctx))
+            {
+                aborted = true;
+                break;
+            }
+        }
+        else if (millis() - last_data_ms > STREAM_STALL_MS)
+        {
+            Log_error("Stream stalled — no data for 5s (%d/%d bytes)", bytes_read, content_size);
+            break;
+        }
+        else
+        {
+            delay(1); // yield to system tasks
+        }
+    }
+
+    close_connection(https, client);
+
+    *out_size = bytes_read;
+    if (aborted)
+    {
+        Log_error("Download of %s aborted by consumer at %d bytes", url, bytes_read);
+        return false;
+    }
+    if (bytes_read != (size_t)content_size)
+    {
+        Log_error("Short read from %s: %d/%d bytes", url, bytes_read, content_size);
+        return false;
+    }
+    Log_info("Streamed %d bytes from %s", bytes_read, url);
+    return true;
+}
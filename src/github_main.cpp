@@ -11,6 +11,20 @@
 #include <crypto.h>
 #include <github_client.h>
 #include <manifest.h>
+#include <image_format.h>
+#include <delta.h>
+#include <frame_cache.h>
+#include <refresh_policy.h>
+#include <display_direct.h>
+#include <bmp_stream.h>
+#include <image_stream.h>
+#include <arena.h>
+#include <stream_pipeline.h>
+#include <wake_state.h>
+#include <timekeeper.h>
+#include <log_ring.h>
+#include <mirror.h>
+#include <esp_ota_ops.h>
 #include <api-client/display.h>  // for ApiDisplayResult type needed by display.cpp extern
 #include <cstdarg>
 #include <cstdio>
@@ -27,28 +41,116 @@ char filename[1024];                // display.cpp extern
 // ---- RTC memory (survives deep sleep) ----
 RTC_DATA_ATTR uint8_t playlist_index = 0;
 RTC_DATA_ATTR uint8_t need_to_refresh_display = 1;
+RTC_DATA_ATTR RefreshState refresh_state = {};  // what the panel shows, partials since full
 
-// ---- NVS keys for our config ----
-#define PREF_MANIFEST_URL    "manifest_url"
-#define PREF_AES_KEY_HEX     "aes_key_hex"
-#define PREF_IMAGES_BASE     "images_base"
-#define PREF_WIFI_RETRY_COUNT "wifi_retry"   // progressive WiFi backoff counter
-#define PREF_API_RETRY_COUNT  "api_retry"    // progressive download backoff counter
-
+// ---- Per-wake arena ----
+// One reservation backs every large buffer of the wake (download, decrypt,
+// manifest parse, framebuffers, decoders); released in one go before sleep.
+// With PSRAM that is one 2 MB block. Without it, the arena is reserved twice,
+// each time sized to what the stage needs: first for the manifest, then, once
+// the manifest has said how big the screen is, for the image. Each TLS
+// session then runs with the rest of the heap.
+//
+// WAKE_ARENA_HEAP_RESERVE is what a reservation always leaves free: the
+// mbedTLS handshake and its record buffers (about 40-50 KB at peak),
+// WiFiClientSecure/HTTPClient, and the decoders display_show_image() mallocs
+// itself. The low-water mark of free heap is logged when the arena is
+// released, to check this headroom on the C3.
+#define WAKE_ARENA_PSRAM_SIZE    (2 * 1024 * 1024)
+#define WAKE_ARENA_HEAP_RESERVE  (64 * 1024)
+#define WAKE_ARENA_MANIFEST_SIZE (64 * 1024)  // ciphertext + plaintext + JSON pool
+#define WAKE_ARENA_DECODER_SLACK (64 * 1024)  // PNGdec/JPEGDEC objects, dither buffer
 
 static unsigned long startup_time = 0;
 static float vBatt = 4.2f;
+static Arena wake_arena;
+static void *wake_arena_block = nullptr;
+static bool wake_arena_psram = false;
+
+// ---- Deferred log (replaces app_logger.cpp) ----
+// Log_* calls only append a binary record to an RTC ring; text is formatted
+// and written out while a serial host is attached. Without one, logging costs
+// no formatting and no waits on USB CDC, and the last ~2 KB of records from
+// earlier wakes are printed once a host shows up. log_mux is held only to copy
+// records in and out; the format scan and snprintf run outside it.
+#define LOG_LINE_SIZE 512
+
+RTC_DATA_ATTR static LogRing log_ring;
+static portMUX_TYPE log_mux = portMUX_INITIALIZER_UNLOCKED;
+static bool log_ring_ready = false;
+
+static uint32_t firmware_image_id()
+{
+    uint32_t id;
+    memcpy(&id, esp_ota_get_app_description()->app_elf_sha256, sizeof(id));
+    return id;
+}
+
+// Called under log_mux
+static void log_ring_prepare()
+{
+    uint32_t image = firmware_image_id();
+    if (!log_ring_valid(log_ring, image))
+        log_ring_reset(log_ring, image);
+    log_ring.wake++;
+    log_ring_ready = true;
+}
+
+// USB CDC reports whether a host has the port open. A UART is always "open",
+// so UART boards only print when built with -D LOG_UART (bench builds with an
+// adapter attached); otherwise the ring is kept for a later CDC/LOG_UART build.
+static bool log_host_attached()
+{
+#if ARDUINO_USB_CDC_ON_BOOT
+    return (bool)Serial;
+#elif defined(LOG_UART)
+    return true;
+#else
+    return false;
+#endif
+}
+
+static void log_drain()
+{
+    uint8_t rec[LOG_RING_RECORD_MAX];
+    char msg[LOG_LINE_SIZE];
+    LogRingEntry entry;
+    for (;;)
+    {
+        portENTER_CRITICAL(&log_mux);
+        uint16_t dropped = log_ring.dropped;
+        log_ring.dropped = 0;
+        size_t len = log_ring_take(log_ring, rec);
+        uint16_t wake = log_ring.wake;
+        portEXIT_CRITICAL(&log_mux);
+
+        if (dropped)
+            Serial.printf("(%u log entries lost)\r\n", dropped);
+        if (len == 0)
+            break;
+        log_ring_format(rec, len, entry, msg, sizeof(msg));
+        if (entry.wake != wake)
+            Serial.printf("[-%u] ", (unsigned)(uint16_t)(wake - entry.wake));  // from an earlier wake
+        Serial.printf("%lu %s [%d]: %s\r\n", (unsigned long)entry.time_ms, entry.file, entry.line, msg);
+    }
+}
 
-// ---- Simple log_impl (replaces app_logger.cpp) ----
 void log_impl(LogLevel level, LogMode mode, const char *file, int line, const char *format, ...)
 {
-    const int BUF_SIZE = 512;
-    char buf[BUF_SIZE];
+    uint8_t rec[LOG_RING_RECORD_MAX];
     va_list args;
     va_start(args, format);
-    vsnprintf(buf, BUF_SIZE, format, args);
+    size_t len = log_ring_encode(rec, (uint8_t)level, millis(), file, line, format, args);
     va_end(args);
-    Serial.printf("%s [%d]: %s\r\n", file, line, buf);
+
+    portENTER_CRITICAL(&log_mux);
+    if (!log_ring_ready)
+        log_ring_prepare();
+    log_ring_push(log_ring, rec, len);
+    portEXIT_CRITICAL(&log_mux);
+
+    if (log_host_attached())
+        log_drain();
 }
 
 // ---- Battery reading ----
@@ -64,17 +166,63 @@ static float readBatteryVoltage()
 #endif
 }
 
+// ---- Arena reserve / release ----
+// `want` only applies without PSRAM, and is capped to leave the reserve free
+static void reserveWakeArena(size_t want)
+{
+    size_t capacity = WAKE_ARENA_PSRAM_SIZE;
+    wake_arena_block = heap_caps_malloc(capacity, MALLOC_CAP_SPIRAM);
+    wake_arena_psram = wake_arena_block != nullptr;
+    if (!wake_arena_block)
+    {
+        size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+        capacity = largest > WAKE_ARENA_HEAP_RESERVE ? largest - WAKE_ARENA_HEAP_RESERVE : 0;
+        if (capacity > want)
+            capacity = want;
+        wake_arena_block = capacity ? malloc(capacity) : nullptr;
+    }
+    arena_init(wake_arena, wake_arena_block, wake_arena_block ? capacity : 0);
+    Log_info("Wake arena: %d bytes reserved (%s), free heap %d", wake_arena.capacity,
+             wake_arena_psram ? "PSRAM" : "heap", ESP.getFreeHeap());
+}
+
+static void releaseWakeArena()
+{
+    if (!wake_arena_block)
+        return;
+    Log_info("Wake arena: high water %d of %d bytes, %d allocation(s), %d refused, min free heap %d",
+             wake_arena.high_water, wake_arena.capacity, wake_arena.allocs, wake_arena.failed,
+             heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+    free(wake_arena_block);
+    wake_arena_block = nullptr;
+    arena_init(wake_arena, nullptr, 0);
+}
+
+// Image stage without PSRAM: encrypted + decrypted image, or cached base,
+// delta both ways and the result; plus a framebuffer and decoder objects.
+// Manifests without sizes get everything the reserve allows.
+static size_t imageArenaSize(const ManifestScreen &screen)
+{
+    if (screen.size == 0)
+        return SIZE_MAX;
+    return 2 * screen.size + 2 * screen.delta_size + DISPLAY_DIRECT_FRAME_BYTES + WAKE_ARENA_DECODER_SLACK;
+}
+
 // ---- Deep sleep ----
 static void goToSleep(uint32_t sleep_seconds)
 {
+    releaseWakeArena();
+
     if (WiFi.status() == WL_CONNECTED)
         WiFi.disconnect();
     WiFi.mode(WIFI_OFF);
 
+    timekeeper_sleep();
     Log_info("Total awake time: %d ms", millis() - startup_time);
     Log_info("Sleeping for %d seconds", sleep_seconds);
 
-    preferences.putUInt(PREFERENCES_SLEEP_TIME_KEY, sleep_seconds);
+    wake_state().sleep_time = sleep_seconds;
+    wake_state_commit(preferences);  // NVS only for values that changed
     preferences.end();
 
     esp_sleep_enable_timer_wakeup((uint64_t)sleep_seconds * SLEEP_uS_TO_S_FACTOR);
@@ -102,6 +250,7 @@ static void resetDeviceCredentials()
 {
     Log_info("Factory reset: clearing WiFi and NVS, restarting");
     WifiCaptivePortal.resetSettings();
+    wake_state_invalidate();  // RTC memory survives ESP.restart()
     Preferences prefs;
     if (prefs.begin("data", false))
     {
@@ -114,6 +263,7 @@ static void resetDeviceCredentials()
 // ---- Show error on display and sleep (fixed duration, for config/decrypt errors) ----
 static void errorAndSleep(MSG msg, uint32_t sleep_seconds)
 {
+    need_to_refresh_display = 1;  // panel no longer shows a known frame
     display_show_msg(const_cast<uint8_t *>(logo_medium), msg);
     display_sleep();
     goToSleep(sleep_seconds);
@@ -121,10 +271,10 @@ static void errorAndSleep(MSG msg, uint32_t sleep_seconds)
 
 // ---- WiFi failure with progressive backoff ----
 // Retry schedule: 60s → 180s → 300s → 900s (normal interval)
-// Counter stored in NVS; reset to 1 on successful WiFi connect.
+// Counter kept in the RTC wake state; reset to 1 on successful WiFi connect.
 static void wifiErrorAndSleep(MSG msg)
 {
-    int retries = preferences.getInt(PREF_WIFI_RETRY_COUNT, 1);
+    int retries = wake_state().wifi_retry;
     uint32_t sleep_secs;
     switch (retries)
     {
@@ -134,7 +284,8 @@ static void wifiErrorAndSleep(MSG msg)
     default: sleep_secs = SLEEP_TIME_TO_SLEEP; break;
     }
     Log_error("WiFi failed (attempt %d), sleeping %ds", retries, sleep_secs);
-    preferences.putInt(PREF_WIFI_RETRY_COUNT, retries + 1);
+    wake_state().wifi_retry = retries + 1;
+    need_to_refresh_display = 1;  // panel no longer shows a known frame
     display_show_msg(const_cast<uint8_t *>(logo_medium), msg);
     display_sleep();
     goToSleep(sleep_secs);
@@ -142,10 +293,10 @@ static void wifiErrorAndSleep(MSG msg)
 
 // ---- Download/network failure with progressive backoff ----
 // Retry schedule: 15s → 30s → 60s → 900s (normal interval)
-// Counter stored in NVS; reset to 1 on successful image display.
+// Counter kept in the RTC wake state; reset to 1 on successful image display.
 static void downloadErrorAndSleep(MSG msg)
 {
-    int retries = preferences.getInt(PREF_API_RETRY_COUNT, 1);
+    int retries = wake_state().api_retry;
     uint32_t sleep_secs;
     switch (retries)
     {
@@ -155,12 +306,467 @@ static void downloadErrorAndSleep(MSG msg)
     default: sleep_secs = SLEEP_TIME_TO_SLEEP; break;
     }
     Log_error("Download failed (attempt %d), sleeping %ds", retries, sleep_secs);
-    preferences.putInt(PREF_API_RETRY_COUNT, retries + 1);
+    wake_state().api_retry = retries + 1;
+    need_to_refresh_display = 1;  // panel no longer shows a known frame
     display_show_msg(const_cast<uint8_t *>(logo_medium), msg);
     display_sleep();
     goToSleep(sleep_secs);
 }
 
+// ---- Cached frame / delta path ----
+// Returns the decrypted image for `screen` without a full download when the
+// frame cache allows it: straight from cache if it already holds screen.hash,
+// or cached base + downloaded delta if it holds screen.delta_base. The applied
+// delta is handed back in delta_out for the partial refresh. Buffers come
+// from the wake arena or mapped flash; on nullptr the caller rewinds the arena
+// and falls back to the full download — never fatal on its own.
+static uint8_t *load_frame_from_cache(const ManifestScreen &screen, const MirrorSet &images,
+                                      const uint8_t *aes_key, size_t *out_size,
+                                      uint8_t **delta_out, size_t *delta_size_out)
+{
+    *delta_out = nullptr;
+    *delta_size_out = 0;
+
+    if (screen.hash.length() == 0)
+        return nullptr;
+
+    uint8_t cached_hash[FRAME_HASH_SIZE];
+    size_t cached_size = 0;
+    if (!frame_cache_peek(screen.name.c_str(), cached_hash, &cached_size))
+        return nullptr;
+
+    char cached_hex[FRAME_HASH_HEX_SIZE];
+    frame_hash_to_hex(cached_hash, cached_hex);
+    bool up_to_date = screen.hash == cached_hex;
+    bool delta_applies = screen.delta_filename.length() > 0 && screen.delta_base == cached_hex;
+    if (!up_to_date && !delta_applies)
+    {
+        Log_info("Frame cache: have %s, need %s — full download", cached_hex, screen.hash.c_str());
+        return nullptr;
+    }
+
+    uint8_t *delta_dec = nullptr;
+    size_t delta_dec_size = 0;
+    size_t capacity = cached_size;
+    if (!up_to_date)
+    {
+        Log_info("Fetching delta: %s", screen.delta_filename.c_str());
+        size_t delta_enc_size = 0;
+        uint8_t *delta_enc = mirror_download(images, screen.delta_filename.c_str(), &delta_enc_size, wake_arena);
+        if (!delta_enc)
+            return nullptr;
+
+        delta_dec = (uint8_t *)arena_alloc(wake_arena, delta_enc_size);
+        if (!delta_dec || !aes256_cbc_decrypt(aes_key, delta_enc, delta_enc_size, delta_dec, &delta_dec_size))
+        {
+            Log_error("Failed to decrypt delta");
+            return nullptr;
+        }
+
+        DeltaHeader header;
+        if (!delta_parse_header(delta_dec, delta_dec_size, header))
+        {
+            Log_error("Delta header invalid");
+            return nullptr;
+        }
+        if (header.target_size > capacity)
+            capacity = header.target_size;
+    }
+
+    // Unchanged non-BMP frame: hand out the mapped image store slot, no copy.
+    // display_show_image() only reads PNG/JPEG/G5; BMPs are flipped in place
+    // and deltas patch the frame, so those still get a RAM copy.
+    uint8_t *frame = nullptr;
+    if (up_to_date && screen.format != IMAGE_FORMAT_BMP && screen.format != IMAGE_FORMAT_UNKNOWN)
+        frame = const_cast<uint8_t *>(frame_cache_map(screen.name.c_str(), out_size));
+    if (!frame)
+    {
+        frame = (uint8_t *)arena_alloc(wake_arena, capacity);
+        if (!frame || !frame_cache_read(screen.name.c_str(), frame, capacity, out_size))
+            return nullptr;
+    }
+
+    if (delta_dec && !delta_apply(delta_dec, delta_dec_size, frame, capacity, out_size))
+    {
+        Log_error("Delta apply failed");
+        return nullptr;
+    }
+
+    // A corrupt cache or bad delta must never reach the panel
+    uint8_t result_hash[FRAME_HASH_SIZE];
+    char result_hex[FRAME_HASH_HEX_SIZE];
+    frame_hash(frame, *out_size, result_hash);
+    frame_hash_to_hex(result_hash, result_hex);
+    if (screen.hash != result_hex)
+    {
+        Log_error("Frame cache: result %s != manifest %s", result_hex, screen.hash.c_str());
+        return nullptr;
+    }
+
+    if (up_to_date)
+        Log_info("Frame cache: %s unchanged, skipping download", screen.name.c_str());
+    else
+        Log_info("Frame cache: applied %d-byte delta to %s", delta_dec_size, screen.name.c_str());
+    *delta_out = delta_dec;
+    *delta_size_out = delta_dec_size;
+    return frame;
+}
+
+// ---- Streaming BMP fast path ----
+// socket → AES-CBC stream → BMP rows → framebuffer. The plaintext is hashed
+// and written to the frame cache as it passes; no copy of the file is held.
+// With STREAM_PIPELINE the sinks below run on the other core.
+struct BmpStreamContext
+{
+    Aes256CbcStream aes;
+    BmpStream bmp;
+    FrameHasher hasher;
+    size_t plain_size;
+    const char *screen_name;
+    uint8_t expected_hash[FRAME_HASH_SIZE];
+    bool cache_pending;  // waiting for the BMP header to learn the file size
+    bool caching;
+};
+
+static bool bmp_plain_sink(const uint8_t *data, size_t len, void *ctx)
+{
+    BmpStreamContext *c = (BmpStreamContext *)ctx;
+    size_t earlier = c->plain_size;
+    frame_hash_update(c->hasher, data, len);
+    c->plain_size += len;
+
+    bool ok = bmp_stream_write(c->bmp, data, len);
+
+    if (c->cache_pending && c->bmp.header_done)
+    {
+        // Bytes from earlier chunks are all header, still held in bmp.header
+        c->cache_pending = false;
+        c->caching = c->bmp.file_size > 0 &&
+                     frame_cache_begin(c->screen_name, c->expected_hash, c->bmp.file_size) &&
+                     frame_cache_append(c->bmp.header, earlier) &&
+                     frame_cache_append(data, len);
+    }
+    else if (c->caching)
+    {
+        c->caching = frame_cache_append(data, len);
+    }
+    return ok;
+}
+
+static bool bmp_cipher_sink(const uint8_t *data, size_t len, void *ctx)
+{
+    BmpStreamContext *c = (BmpStreamContext *)ctx;
+    return aes256_cbc_stream_update(c->aes, data, len, bmp_plain_sink, c);
+}
+
+// The sinks consume what arrives, so only an origin that sent nothing is retried
+static bool bmp_stream_attempt(const char *url, void *ctx, size_t *delivered)
+{
+    return stream_pipeline_download(url, bmp_cipher_sink, ctx, delivered, wake_arena);
+}
+
+// Returns false only if the fast path can't start (no framebuffer memory);
+// failures after the download has begun are fatal like on the buffered path.
+static bool stream_bmp_to_panel(const ManifestScreen &screen, const MirrorSet &images,
+                                const uint8_t *aes_key, uint32_t sleep_seconds)
+{
+    size_t mark = arena_mark(wake_arena);
+    uint8_t *framebuffer = display_direct_framebuffer();
+    if (!framebuffer)
+        framebuffer = (uint8_t *)arena_alloc(wake_arena, DISPLAY_DIRECT_FRAME_BYTES);
+    BmpStreamContext *c = (BmpStreamContext *)arena_alloc(wake_arena, sizeof(BmpStreamContext));
+    if (!framebuffer || !c)
+    {
+        arena_rewind(wake_arena, mark);
+        Log_info("No memory for framebuffer — using buffered image path");
+        return false;
+    }
+    memset(c, 0, sizeof(*c));
+    bmp_stream_begin(c->bmp, framebuffer, DISPLAY_DIRECT_WIDTH, DISPLAY_DIRECT_HEIGHT);
+    aes256_cbc_stream_begin(c->aes, aes_key);
+    frame_hash_begin(c->hasher);
+    c->screen_name = screen.name.c_str();
+    c->cache_pending = screen.hash.length() == FRAME_HASH_SIZE * 2 &&
+                       hex_to_bytes(screen.hash.c_str(), c->expected_hash, FRAME_HASH_SIZE);
+
+    Log_info("Streaming image: %s", screen.filename.c_str());
+    bool downloaded = mirror_fetch(images, screen.filename.c_str(), bmp_stream_attempt, c);
+
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+
+    bool decrypted = downloaded && aes256_cbc_stream_finish(c->aes, bmp_plain_sink, c);
+    uint8_t image_hash[FRAME_HASH_SIZE];
+    frame_hash_finish(c->hasher, image_hash);
+    bool bmp_ok = bmp_stream_complete(c->bmp);
+    bool hash_ok = true;
+    if (screen.hash.length() > 0)
+    {
+        char hex[FRAME_HASH_HEX_SIZE];
+        frame_hash_to_hex(image_hash, hex);
+        hash_ok = screen.hash == hex;
+    }
+    bool image_reverse = false;
+    bmp_err_e bmp_res = bmp_ok ? parseBMPHeader(c->bmp.header, image_reverse) : BMP_NO_ERR;
+
+    if (c->caching && decrypted && bmp_ok && hash_ok)
+        frame_cache_commit(image_hash);
+    else
+        frame_cache_abort();
+    size_t plain_size = c->plain_size;
+    bool stream_failed = c->bmp.failed;
+    aes256_cbc_stream_abort(c->aes);
+
+    if (!downloaded && !stream_failed)
+    {
+        Log_error("Failed to download image");
+        downloadErrorAndSleep(API_IMAGE_DOWNLOAD_ERROR);  // does not return
+    }
+    if (!decrypted && !stream_failed)
+    {
+        Log_error("Failed to decrypt image");
+        errorAndSleep(API_ERROR, 300);
+    }
+    if (!bmp_ok || bmp_res != BMP_NO_ERR)
+    {
+        Log_error("Streamed BMP invalid (error %d, %d bytes)", bmp_res, plain_size);
+        errorAndSleep(MSG_FORMAT_ERROR, 300);
+    }
+    if (!hash_ok)
+    {
+        Log_error("Streamed image does not match manifest hash %s", screen.hash.c_str());
+        errorAndSleep(API_ERROR, 300);
+    }
+
+    RefreshRequest refresh_req = {};
+    refresh_req.force_full = need_to_refresh_display != 0;
+    refresh_req.target_hash = image_hash;
+    refresh_req.panel_area = DISPLAY_DIRECT_WIDTH * DISPLAY_DIRECT_HEIGHT;
+    RefreshAction action = refresh_policy_decide(refresh_state, refresh_req);
+
+    if (action == REFRESH_ACTION_SKIP)
+    {
+        Log_info("Panel already shows %s — skipping refresh", screen.name.c_str());
+    }
+    else
+    {
+        PanelRefresh mode = refresh_policy_panel_mode(refresh_state, refresh_req.force_full, sleep_seconds);
+        Log_info("Displaying streamed BMP (%d bytes, no plaintext buffer)", plain_size);
+        display_show_framebuffer(framebuffer, image_reverse, mode);
+        action = mode == PANEL_REFRESH_PARTIAL ? REFRESH_ACTION_PARTIAL : REFRESH_ACTION_FULL;
+    }
+    refresh_policy_record(refresh_state, action, image_hash);
+    return true;
+}
+
+// Whole-image refresh on the buffered path. 1-bpp BMPs go through the
+// framebuffer so the waveform comes from refresh_policy_panel_mode(), like the
+// streamed path; everything else is left to display_show_image().
+// Returns the action to record.
+static RefreshAction show_buffered_image(uint8_t *image, size_t image_size, ImageFormat format,
+                                         bool force_full, uint32_t sleep_seconds)
+{
+    if (format == IMAGE_FORMAT_BMP && display_direct_supported())
+    {
+        size_t mark = arena_mark(wake_arena);
+        uint8_t *framebuffer = display_direct_framebuffer();
+        if (!framebuffer)
+            framebuffer = (uint8_t *)arena_alloc(wake_arena, DISPLAY_DIRECT_FRAME_BYTES);
+        BmpStream bmp;
+        bool image_reverse = false;
+        if (framebuffer)
+        {
+            bmp_stream_begin(bmp, framebuffer, DISPLAY_DIRECT_WIDTH, DISPLAY_DIRECT_HEIGHT);
+            if (bmp_stream_write(bmp, image, image_size) && bmp_stream_complete(bmp) &&
+                parseBMPHeader(image, image_reverse) == BMP_NO_ERR)
+            {
+                PanelRefresh mode = refresh_policy_panel_mode(refresh_state, force_full, sleep_seconds);
+                Log_info("Displaying BMP image (%d bytes) from framebuffer", image_size);
+                display_show_framebuffer(framebuffer, image_reverse, mode);
+                arena_rewind(wake_arena, mark);
+                return mode == PANEL_REFRESH_PARTIAL ? REFRESH_ACTION_PARTIAL : REFRESH_ACTION_FULL;
+            }
+        }
+        arena_rewind(wake_arena, mark);
+        Log_info("BMP doesn't fit the framebuffer path — using display_show_image()");
+    }
+
+    Log_info("Displaying %s image (%d bytes)", image_format_name(format), image_size);
+    display_show_image(image, image_size, true);
+    // display_show_image() picks its waveform itself and may do a partial;
+    // counting it as one can only bring the next forced full refresh forward
+    return REFRESH_ACTION_PARTIAL;
+}
+
+// ---- Spooled PNG/JPEG path (boards without PSRAM) ----
+// The encrypted file goes to flash and the decoder pulls plaintext from it a
+// window at a time, so no buffer the size of the image is ever allocated.
+// Same contract as stream_bmp_to_panel(), and also returns false when flash
+// can't take the file but the buffered path can.
+struct SpoolAttempt
+{
+    bool storage_failed;
+};
+
+static bool spool_attempt(const char *url, void *ctx, size_t *delivered)
+{
+    SpoolAttempt *a = (SpoolAttempt *)ctx;
+    size_t written = 0;
+    SpoolResult res = image_stream_spool(url, &written);
+    if (res == SPOOL_STORAGE_FAILED)
+    {
+        // Not the origin's fault, and every other origin would fill flash the
+        // same way: mark as delivered so it is neither penalised nor retried
+        a->storage_failed = true;
+        *delivered = written > 0 ? written : 1;
+    }
+    // Otherwise the spool file is rewritten from the start, so any origin can be retried
+    return res == SPOOL_OK;
+}
+
+// Flash can't hold the spool. The buffered path still works when the wake
+// arena takes the encrypted and the decrypted file; otherwise report a
+// storage problem rather than a download error.
+static bool spool_unavailable(const ManifestScreen &screen)
+{
+    size_t arena_free = wake_arena.capacity - wake_arena.used;
+    if (screen.size == 0 || arena_free >= 2 * screen.size)
+    {
+        Log_info("No flash for the image spool — using buffered image path");
+        return false;
+    }
+    Log_error("Image (%d bytes) fits neither the flash spool nor RAM (%d bytes free)",
+              screen.size, arena_free);
+    errorAndSleep(MSG_TOO_BIG, 300);  // does not return
+    return false;
+}
+
+// Second decode pass of a 4-gray PNG, from display_show_gray()
+struct LowPlaneContext
+{
+    const uint8_t *aes_key;
+    size_t arena_mark;
+};
+
+static bool decode_low_plane(uint8_t *framebuffer, void *ctx)
+{
+    LowPlaneContext *c = (LowPlaneContext *)ctx;
+    arena_rewind(wake_arena, c->arena_mark);
+    return image_stream_decode(IMAGE_FORMAT_PNG, c->aes_key, framebuffer, wake_arena,
+                               IMAGE_STREAM_LOW_BIT, nullptr);
+}
+
+static bool spool_image_to_panel(const ManifestScreen &screen, const MirrorSet &images,
+                                 const uint8_t *aes_key, uint32_t sleep_seconds)
+{
+    size_t mark = arena_mark(wake_arena);
+    uint8_t *framebuffer = display_direct_framebuffer();
+    if (!framebuffer)
+        framebuffer = (uint8_t *)arena_alloc(wake_arena, DISPLAY_DIRECT_FRAME_BYTES);
+    if (!framebuffer)
+    {
+        Log_info("No memory for framebuffer — using buffered image path");
+        return false;
+    }
+    if (!image_stream_reserve(screen.size))
+    {
+        arena_rewind(wake_arena, mark);
+        return spool_unavailable(screen);
+    }
+
+    Log_info("Spooling image to flash: %s", screen.filename.c_str());
+    SpoolAttempt attempt = {};
+    bool downloaded = mirror_fetch(images, screen.filename.c_str(), spool_attempt, &attempt);
+    if (!downloaded && attempt.storage_failed)
+    {
+        image_stream_discard();
+        arena_rewind(wake_arena, mark);
+        return spool_unavailable(screen);  // WiFi is still up for the buffered path
+    }
+
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+
+    if (!downloaded)
+    {
+        Log_error("Failed to download image");
+        downloadErrorAndSleep(API_IMAGE_DOWNLOAD_ERROR);  // does not return
+    }
+
+    uint8_t expected_hash[FRAME_HASH_SIZE];
+    bool have_hash = screen.hash.length() == FRAME_HASH_SIZE * 2 &&
+                     hex_to_bytes(screen.hash.c_str(), expected_hash, FRAME_HASH_SIZE);
+    uint8_t image_hash[FRAME_HASH_SIZE];
+    size_t plain_size = 0;
+    if (!image_stream_digest(aes_key, screen.name.c_str(), have_hash ? expected_hash : nullptr,
+                             image_hash, &plain_size))
+    {
+        image_stream_discard();
+        Log_error("Failed to decrypt image");
+        errorAndSleep(API_ERROR, 300);
+    }
+    if (have_hash && memcmp(image_hash, expected_hash, FRAME_HASH_SIZE) != 0)
+    {
+        image_stream_discard();
+        Log_error("Spooled image does not match manifest hash %s", screen.hash.c_str());
+        errorAndSleep(API_ERROR, 300);
+    }
+
+    RefreshRequest refresh_req = {};
+    refresh_req.force_full = need_to_refresh_display != 0;
+    refresh_req.target_hash = image_hash;
+    refresh_req.panel_area = DISPLAY_DIRECT_WIDTH * DISPLAY_DIRECT_HEIGHT;
+    RefreshAction action = refresh_policy_decide(refresh_state, refresh_req);
+
+    if (action == REFRESH_ACTION_SKIP)
+    {
+        Log_info("Panel already shows %s — skipping refresh", screen.name.c_str());
+    }
+    else
+    {
+        Log_info("Decoding %s from flash (%d bytes, free heap %d)", image_format_name(screen.format),
+                 plain_size, ESP.getFreeHeap());
+        // First pass gives the 1-bpp image and tells whether it needs 4-gray
+        LowPlaneContext low = {aes_key, arena_mark(wake_arena)};
+        uint8_t levels = 0;
+        bool ok = image_stream_decode(screen.format, aes_key, framebuffer, wake_arena,
+                                      IMAGE_STREAM_HIGH_BIT, &levels);
+        if (ok && image_stream_is_gray(levels) && display_gray_supported())
+        {
+            // Like png_to_epd(): both planes, 4-gray waveform, always full
+            ok = display_show_gray(framebuffer, preferences.getUInt("temp_profile", 0),
+                                   decode_low_plane, &low);
+            action = REFRESH_ACTION_FULL;
+        }
+        else if (ok)
+        {
+            PanelRefresh mode = refresh_policy_panel_mode(refresh_state, refresh_req.force_full, sleep_seconds);
+            display_show_framebuffer(framebuffer, false, mode);
+            action = mode == PANEL_REFRESH_PARTIAL ? REFRESH_ACTION_PARTIAL : REFRESH_ACTION_FULL;
+        }
+        if (!ok)
+        {
+            image_stream_discard();
+            Log_error("Streamed %s decode failed", image_format_name(screen.format));
+            errorAndSleep(MSG_FORMAT_ERROR, 300);
+        }
+    }
+    refresh_policy_record(refresh_state, action, image_hash);
+    image_stream_discard();
+    return true;
+}
+
+// ---- Successful cycle: reset counters and sleep ----
+static void finishAndSleep(uint32_t sleep_seconds)
+{
+    // Both counters reset — full successful cycle completed
+    wake_state().api_retry = 1;
+    need_to_refresh_display = 0;
+
+    display_sleep();
+    goToSleep(sleep_seconds);
+}
+
 // ---- Main setup (runs on every wake) ----
 void setup()
 {
@@ -181,6 +787,7 @@ void setup()
 
     pins_init();
     vBatt = readBatteryVoltage();
+    timekeeper_begin();
 
     esp_sleep_wakeup_cause_t wakeup_reason = esp_sleep_get_wakeup_cause();
 
@@ -243,12 +850,13 @@ void setup()
         Log_fatal("Preferences init failed");
         ESP.restart();
     }
+    wake_state_begin(preferences);
 
     // DoubleClick: clear any accumulated download backoff so the user-requested
     // refresh isn't delayed by a previous failure's retry counter.
     if (double_clicked)
     {
-        preferences.putInt(PREF_API_RETRY_COUNT, 1);
+        wake_state().api_retry = 1;
         Log_info("Double click: download retry counter reset");
     }
 
@@ -282,11 +890,12 @@ void setup()
             wifiErrorAndSleep(WIFI_FAILED);  // does not return
         }
         Log_info("WiFi connected: %s", WiFi.localIP().toString().c_str());
-        preferences.putInt(PREF_WIFI_RETRY_COUNT, 1);  // reset backoff on success
+        wake_state().wifi_retry = 1;  // reset backoff on success
     }
     else
     {
         Log_info("No WiFi saved, starting captive portal");
+        need_to_refresh_display = 1;
         display_show_msg(const_cast<uint8_t *>(logo_medium), WIFI_CONNECT,
                          "", false, FW_VERSION_STRING, "");
         WifiCaptivePortal.setResetSettingsCallback(resetDeviceCredentials);
@@ -295,28 +904,21 @@ void setup()
             wifiErrorAndSleep(WIFI_FAILED);  // does not return
         }
         Log_info("WiFi connected via portal");
-        preferences.putInt(PREF_WIFI_RETRY_COUNT, 1);  // reset backoff on success
+        wake_state().wifi_retry = 1;  // reset backoff on success
     }
 
-    // ---- NTP clock sync (best-effort) ----
-    // Not required for HTTPS — setInsecure() skips cert date validation — but
-    // corrects log timestamps and future-proofs against pinned certificates.
-    // 2s timeout; failure is logged but does not block the main flow.
-    configTime(0, 0, "time.google.com", "time.cloudflare.com");
-    {
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo, 2000))
-            Log_info("NTP synced: %04d-%02d-%02d %02d:%02d:%02d",
-                     timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                     timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-        else
-            Log_info("NTP sync timed out — continuing with system clock");
-    }
+    // ---- Clock: background NTP only when the RTC estimate has drifted too far ----
+    timekeeper_start_sync();
 
-    // ---- Load config from NVS ----
-    String manifest_url = preferences.getString(PREF_MANIFEST_URL, GITHUB_PAGES_MANIFEST_URL);
-    String images_base = preferences.getString(PREF_IMAGES_BASE, GITHUB_PAGES_IMAGES_BASE);
-    String aes_key_hex = preferences.getString(PREF_AES_KEY_HEX, GITHUB_PAGES_AES_KEY_HEX);
+    // ---- Load config (RTC snapshot of NVS, taken on cold boot) ----
+    String manifest_url, images_base, aes_key_hex;
+    wake_state_config(preferences, manifest_url, images_base, aes_key_hex,
+                      GITHUB_PAGES_MANIFEST_URL, GITHUB_PAGES_IMAGES_BASE, GITHUB_PAGES_AES_KEY_HEX);
+
+    // Either URL setting may list several origins; see mirror.h
+    mirror_begin();
+    MirrorSet manifest_origins = {};
+    mirror_set_add(manifest_origins, manifest_url);
 
     uint8_t aes_key[AES256_KEY_SIZE];
     if (!hex_to_bytes(aes_key_hex.c_str(), aes_key, AES256_KEY_SIZE))
@@ -328,9 +930,11 @@ void setup()
     // ---- Fetch and decrypt manifest ----
     Log_info("Free heap before download: %d bytes (largest block: %d)",
              ESP.getFreeHeap(), heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+    reserveWakeArena(WAKE_ARENA_MANIFEST_SIZE);
+    size_t manifest_mark = arena_mark(wake_arena);
     Log_info("Fetching manifest: %s", manifest_url.c_str());
     size_t manifest_enc_size = 0;
-    uint8_t *manifest_enc = https_download(manifest_url.c_str(), &manifest_enc_size);
+    uint8_t *manifest_enc = mirror_download(manifest_origins, "", &manifest_enc_size, wake_arena);
     if (!manifest_enc)
     {
         Log_error("Failed to download manifest");
@@ -339,32 +943,34 @@ void setup()
 
     // Decrypt manifest
     size_t manifest_dec_size = 0;
-    uint8_t *manifest_dec = (uint8_t *)malloc(manifest_enc_size);
+    uint8_t *manifest_dec = (uint8_t *)arena_alloc(wake_arena, manifest_enc_size);
     if (!manifest_dec)
     {
-        free(manifest_enc);
         Log_error("Failed to allocate manifest decrypt buffer");
         errorAndSleep(API_ERROR, 60);
     }
 
     if (!aes256_cbc_decrypt(aes_key, manifest_enc, manifest_enc_size, manifest_dec, &manifest_dec_size))
     {
-        free(manifest_enc);
-        free(manifest_dec);
         Log_error("Failed to decrypt manifest");
         errorAndSleep(API_ERROR, 300);
     }
-    free(manifest_enc);
 
     // Parse manifest
     Manifest manifest;
-    if (!parse_manifest(manifest_dec, manifest_dec_size, manifest))
+    if (!parse_manifest(manifest_dec, manifest_dec_size, manifest, &wake_arena))
     {
-        free(manifest_dec);
         Log_error("Failed to parse manifest");
         errorAndSleep(API_ERROR, 300);
     }
-    free(manifest_dec);
+    // Screens are copied out; ciphertext, plaintext and JSON pool are dead
+    arena_rewind(wake_arena, manifest_mark);
+
+    // Configured image bases first, then any the manifest adds
+    MirrorSet image_origins = {};
+    mirror_set_add(image_origins, images_base);
+    for (int i = 0; i < manifest.mirror_count; i++)
+        mirror_set_add(image_origins, manifest.mirrors[i]);
 
     Log_info("Manifest: %d screens, refresh_rate=%d", manifest.screen_count, manifest.refresh_rate);
 
@@ -376,65 +982,101 @@ void setup()
     Log_info("Screen %d/%d: %s (%s)", playlist_index + 1, manifest.screen_count,
              screen.name.c_str(), screen.filename.c_str());
 
+    // Without PSRAM the manifest arena is swapped for one sized to this screen
+    if (!wake_arena_psram)
+    {
+        releaseWakeArena();
+        reserveWakeArena(imageArenaSize(screen));
+    }
+
     // Advance playlist for next wake
     playlist_index = (playlist_index + 1) % manifest.screen_count;
 
-    // ---- Download encrypted image ----
-    String image_url = images_base + screen.filename;
-    Log_info("Fetching image: %s", image_url.c_str());
+    // ---- Cached frame or delta, else download full encrypted image ----
+    size_t image_dec_size = 0;
+    uint8_t *delta_dec = nullptr;
+    size_t delta_dec_size = 0;
+    size_t image_mark = arena_mark(wake_arena);
+    uint8_t *image_dec = load_frame_from_cache(screen, image_origins, aes_key, &image_dec_size,
+                                               &delta_dec, &delta_dec_size);
+    if (!image_dec)
+        arena_rewind(wake_arena, image_mark);
 
-    size_t image_enc_size = 0;
-    uint8_t *image_enc = https_download(image_url.c_str(), &image_enc_size);
-    if (!image_enc)
+    // 1-bpp BMP on a mono bb_epaper panel: decrypt straight into the framebuffer
+    if (!image_dec && screen.format == IMAGE_FORMAT_BMP && display_direct_supported() &&
+        stream_bmp_to_panel(screen, image_origins, aes_key, manifest.refresh_rate))
     {
-        Log_error("Failed to download image");
-        downloadErrorAndSleep(API_IMAGE_DOWNLOAD_ERROR);  // does not return
+        finishAndSleep(manifest.refresh_rate);  // does not return
     }
 
-    // Done with WiFi
-    WiFi.disconnect(true);
-    WiFi.mode(WIFI_OFF);
-
-    // ---- Decrypt image ----
-    size_t image_dec_size = 0;
-    uint8_t *image_dec = (uint8_t *)heap_caps_malloc(image_enc_size, MALLOC_CAP_SPIRAM);
-    if (!image_dec)
+    // PNG/JPEG without PSRAM: the decrypted file wouldn't fit, decode from flash
+    if (!image_dec && (screen.format == IMAGE_FORMAT_PNG || screen.format == IMAGE_FORMAT_JPEG) &&
+        !psramFound() && display_direct_supported() &&
+        spool_image_to_panel(screen, image_origins, aes_key, manifest.refresh_rate))
     {
-        image_dec = (uint8_t *)malloc(image_enc_size);
+        finishAndSleep(manifest.refresh_rate);  // does not return
     }
+
     if (!image_dec)
     {
-        free(image_enc);
-        Log_error("Failed to allocate image decrypt buffer");
-        errorAndSleep(API_ERROR, 60);
-    }
+        Log_info("Fetching image: %s", screen.filename.c_str());
+
+        size_t image_enc_size = 0;
+        uint8_t *image_enc = mirror_download(image_origins, screen.filename.c_str(), &image_enc_size, wake_arena);
+        if (!image_enc)
+        {
+            Log_error("Failed to download image");
+            downloadErrorAndSleep(API_IMAGE_DOWNLOAD_ERROR);  // does not return
+        }
+
+        // Done with WiFi
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
+
+        // ---- Decrypt image ----
+        image_dec = (uint8_t *)arena_alloc(wake_arena, image_enc_size);
+        if (!image_dec)
+        {
+            Log_error("Failed to allocate image decrypt buffer (%d bytes)", image_enc_size);
+            errorAndSleep(API_ERROR, 60);
+        }
 
-    if (!aes256_cbc_decrypt(aes_key, image_enc, image_enc_size, image_dec, &image_dec_size))
+        if (!aes256_cbc_decrypt(aes_key, image_enc, image_enc_size, image_dec, &image_dec_size))
+        {
+            Log_error("Failed to decrypt image");
+            errorAndSleep(API_ERROR, 300);
+        }
+    }
+    else
     {
-        free(image_enc);
-        free(image_dec);
-        Log_error("Failed to decrypt image");
-        errorAndSleep(API_ERROR, 300);
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
     }
-    free(image_enc);
 
     // ---- Detect format and display image ----
     // display_show_image() does its own magic-byte detection internally (PNG/JPEG/
-    // BMP/G5). We pre-check here to: (a) validate BMP headers for a clear error
-    // message, and (b) reject completely unknown formats before the display driver
-    // sees them.
-    if (image_dec_size < 4)
+    // BMP/G5). We pre-check here to: (a) validate BMP/G5 headers for a clear error
+    // message, (b) reject completely unknown formats before the display driver
+    // sees them, and (c) catch a mismatch with the format the manifest promised.
+    ImageFormat format = detect_image_format(image_dec, image_dec_size);
+
+    if (format == IMAGE_FORMAT_UNKNOWN)
     {
-        Log_error("Image too small to detect format: %d bytes", image_dec_size);
-        free(image_dec);
+        if (image_dec_size < 4)
+            Log_error("Image too small to detect format: %d bytes", image_dec_size);
+        else
+            Log_error("Unknown image format (magic: %02x %02x)", image_dec[0], image_dec[1]);
         errorAndSleep(MSG_FORMAT_ERROR, 300);
     }
 
-    bool is_bmp  = (image_dec[0] == 'B'  && image_dec[1] == 'M');
-    bool is_png  = (image_dec[0] == 0x89 && image_dec[1] == 0x50);  // PNG magic
-    bool is_jpeg = (image_dec[0] == 0xFF && image_dec[1] == 0xD8);  // JPEG SOI
+    if (screen.format != IMAGE_FORMAT_UNKNOWN && screen.format != format)
+    {
+        Log_error("Manifest says %s but image is %s",
+                  image_format_name(screen.format), image_format_name(format));
+        errorAndSleep(MSG_FORMAT_ERROR, 300);
+    }
 
-    if (is_bmp)
+    if (format == IMAGE_FORMAT_BMP)
     {
         // Validate BMP header: dimensions must be 800x480, 1-bpp, correct color table.
         // parseBMPHeader() also sets image_reverse if the color table is inverted.
@@ -443,29 +1085,64 @@ void setup()
         if (bmp_res != BMP_NO_ERR)
         {
             Log_error("BMP header invalid (error %d)", bmp_res);
-            free(image_dec);
             errorAndSleep(MSG_FORMAT_ERROR, 300);
         }
     }
-    else if (!is_png && !is_jpeg)
+    else if (format == IMAGE_FORMAT_G5)
     {
-        Log_error("Unknown image format (magic: %02x %02x)", image_dec[0], image_dec[1]);
-        free(image_dec);
-        errorAndSleep(MSG_FORMAT_ERROR, 300);
+        // G5 goes straight to bbep.loadG5Image() — no PNG inflate, no plane passes.
+        if (!g5_header_valid(image_dec, image_dec_size))
+        {
+            Log_error("G5 header invalid (%d bytes)", image_dec_size);
+            errorAndSleep(MSG_FORMAT_ERROR, 300);
+        }
     }
 
-    Log_info("Displaying %s image (%d bytes)",
-             is_bmp ? "BMP" : is_png ? "PNG" : "JPEG", image_dec_size);
-    display_show_image(image_dec, image_dec_size, true);
-    free(image_dec);
+    // Keep this frame as the base for the next delta / unchanged-screen check.
+    // Must happen before display: display_show_image() flips BMPs in place.
+    frame_cache_store(screen.name.c_str(), image_dec, image_dec_size);
 
-    // Both counters reset — full successful cycle completed
-    preferences.putInt(PREF_API_RETRY_COUNT, 1);
-    need_to_refresh_display = 0;
+    // ---- Pick refresh: skip, partial from the delta, or full image ----
+    uint8_t image_hash[FRAME_HASH_SIZE];
+    frame_hash(image_dec, image_dec_size, image_hash);
+
+    DeltaHeader delta_header;
+    bool have_delta = delta_dec && delta_parse_header(delta_dec, delta_dec_size, delta_header);
+
+    RefreshRequest refresh_req;
+    refresh_req.force_full = need_to_refresh_display != 0;
+    refresh_req.partial_capable = format == IMAGE_FORMAT_BMP && display_direct_supported();
+    refresh_req.target_hash = image_hash;
+    refresh_req.delta = have_delta ? &delta_header : nullptr;
+    refresh_req.panel_area = DISPLAY_DIRECT_WIDTH * DISPLAY_DIRECT_HEIGHT;
+    RefreshAction action = refresh_policy_decide(refresh_state, refresh_req);
+
+    if (action == REFRESH_ACTION_PARTIAL)
+    {
+        Log_info("Partial refresh from delta: %d region(s), %d px changed, partial %d/%d", delta_header.rect_count,
+                 delta_rect_area(delta_header), refresh_state.partials_since_full + 1,
+                 REFRESH_MAX_PARTIALS);
+        uint8_t *scratch = (uint8_t *)arena_alloc(wake_arena, DISPLAY_DIRECT_FRAME_BYTES);
+        if (!scratch || !display_show_bmp_delta(image_dec, image_dec_size, delta_dec, delta_dec_size, scratch))
+        {
+            Log_error("Partial refresh failed — falling back to full image");
+            action = REFRESH_ACTION_FULL;
+        }
+    }
+
+    if (action == REFRESH_ACTION_SKIP)
+    {
+        Log_info("Panel already shows %s — skipping refresh", screen.name.c_str());
+    }
+    else if (action == REFRESH_ACTION_FULL)
+    {
+        action = show_buffered_image(image_dec, image_dec_size, format, refresh_req.force_full,
+                                     manifest.refresh_rate);
+    }
+    refresh_policy_record(refresh_state, action, image_hash);
 
     // ---- Sleep ----
-    display_sleep();
-    goToSleep(manifest.refresh_rate);
+    finishAndSleep(manifest.refresh_rate);
 }
 
 void loop()
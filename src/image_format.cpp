@@ -0,0 +1,60 @@
+#include "image_format.h"
+#include <cstring>
+
+ImageFormat detect_image_format(const uint8_t *data, size_t len)
+{
+    if (!data || len < 4)
+        return IMAGE_FORMAT_UNKNOWN;
+
+    if (data[0] == 'B' && data[1] == 'M')
+        return IMAGE_FORMAT_BMP;
+    if (data[0] == 0x89 && data[1] == 0x50 && data[2] == 0x4E && data[3] == 0x47)
+        return IMAGE_FORMAT_PNG;
+    if (data[0] == 0xFF && data[1] == 0xD8)  // JPEG SOI
+        return IMAGE_FORMAT_JPEG;
+    if (data[0] == (G5_MARKER & 0xFF) && data[1] == (G5_MARKER >> 8))  // little-endian marker
+        return IMAGE_FORMAT_G5;
+
+    return IMAGE_FORMAT_UNKNOWN;
+}
+
+ImageFormat image_format_from_name(const char *name)
+{
+    if (!name)
+        return IMAGE_FORMAT_UNKNOWN;
+    if (strcmp(name, "bmp") == 0)
+        return IMAGE_FORMAT_BMP;
+    if (strcmp(name, "png") == 0)
+        return IMAGE_FORMAT_PNG;
+    if (strcmp(name, "jpeg") == 0 || strcmp(name, "jpg") == 0)
+        return IMAGE_FORMAT_JPEG;
+    if (strcmp(name, "g5") == 0)
+        return IMAGE_FORMAT_G5;
+    return IMAGE_FORMAT_UNKNOWN;
+}
+
+const char *image_format_name(ImageFormat format)
+{
+    switch (format)
+    {
+    case IMAGE_FORMAT_BMP:  return "BMP";
+    case IMAGE_FORMAT_PNG:  return "PNG";
+    case IMAGE_FORMAT_JPEG: return "JPEG";
+    case IMAGE_FORMAT_G5:   return "G5";
+    default:                return "unknown";
+    }
+}
+
+bool g5_header_valid(const uint8_t *data, size_t len)
+{
+    if (detect_image_format(data, len) != IMAGE_FORMAT_G5 || len < G5_HEADER_SIZE)
+        return false;
+
+    int16_t width = (int16_t)(data[2] | (data[3] << 8));
+    int16_t height = (int16_t)(data[4] | (data[5] << 8));
+    uint16_t size = (uint16_t)(data[6] | (data[7] << 8));
+
+    if (width <= 0 || height <= 0 || size == 0)
+        return false;
+    return (size_t)size + G5_HEADER_SIZE <= len;
+}
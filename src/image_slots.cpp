@@ -0,0 +1,79 @@
+#include "image_store.h"
+
+bool image_slot_valid(const ImageSlotHeader &h, size_t slot_size)
+{
+    return h.magic == IMAGE_SLOT_MAGIC && h.seq != 0 && h.seq != 0xFFFFFFFF &&
+           h.size > 0 && h.size <= slot_size - IMAGE_SLOT_HEADER_SIZE;
+}
+
+int image_slots_find(const ImageSlotHeader *slots, int count, size_t slot_size, uint32_t key)
+{
+    int best = -1;
+    for (int i = 0; i < count; i++)
+    {
+        if (!image_slot_valid(slots[i], slot_size) || slots[i].key != key)
+            continue;
+        if (best < 0 || slots[i].seq > slots[best].seq)
+            best = i;
+    }
+    return best;
+}
+
+// An older copy of a key that has a newer slot elsewhere
+static bool superseded(const ImageSlotHeader *slots, int count, size_t slot_size, int i)
+{
+    return image_slots_find(slots, count, slot_size, slots[i].key) != i;
+}
+
+int image_slots_pick(const ImageSlotHeader *slots, int count, size_t slot_size, uint32_t key)
+{
+    if (count < 2)
+        return -1;
+
+    int current = image_slots_find(slots, count, slot_size, key);
+    int best = -1;
+    int best_rank = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (i == current)
+            continue;
+
+        // Lower rank wins: 0 unused, 1 superseded, 2 live (evict oldest)
+        int rank;
+        if (!image_slot_valid(slots[i], slot_size))
+            rank = 0;
+        else if (superseded(slots, count, slot_size, i))
+            rank = 1;
+        else
+            rank = 2;
+
+        if (best < 0 || rank < best_rank)
+        {
+            best = i;
+            best_rank = rank;
+            continue;
+        }
+        if (rank != best_rank)
+            continue;
+
+        // Same rank: spread wear — fewest erases, then oldest write
+        const ImageSlotHeader &a = slots[i];
+        const ImageSlotHeader &b = slots[best];
+        uint32_t a_erases = a.erase_count == 0xFFFFFFFF ? 0 : a.erase_count;
+        uint32_t b_erases = b.erase_count == 0xFFFFFFFF ? 0 : b.erase_count;
+        if (a_erases < b_erases || (a_erases == b_erases && rank > 0 && a.seq < b.seq))
+            best = i;
+    }
+    return best;
+}
+
+uint32_t image_slots_next_seq(const ImageSlotHeader *slots, int count, size_t slot_size)
+{
+    uint32_t max_seq = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (image_slot_valid(slots[i], slot_size) && slots[i].seq > max_seq)
+            max_seq = slots[i].seq;
+    }
+    return max_seq + 1;
+}
@@ -0,0 +1,198 @@
+#include "image_store.h"
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+#include <trmnl_log.h>
+
+#define SECTOR_SIZE 4096
+#define IMAGE_STORE_SUBTYPE ((esp_partition_subtype_t)0x40)
+
+static const esp_partition_t *partition = nullptr;
+static bool scanned = false;
+static int slot_count = 0;
+static ImageSlotHeader slots[IMAGE_STORE_MAX_SLOTS];
+
+// Current mapping — one slot at a time, 256 KB of the data MMU pages
+static spi_flash_mmap_handle_t map_handle;
+static bool mapped = false;
+
+// State of the single write (image_store_begin / append / commit)
+static int write_slot = -1;
+static ImageSlotHeader write_header;
+static size_t write_pos = 0;
+
+static size_t slot_offset(int slot)
+{
+    return (size_t)slot * IMAGE_STORE_SLOT_SIZE;
+}
+
+static void unmap()
+{
+    if (!mapped)
+        return;
+    spi_flash_munmap(map_handle);
+    mapped = false;
+}
+
+bool image_store_init()
+{
+    if (scanned)
+        return partition != nullptr;
+    scanned = true;
+
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, IMAGE_STORE_SUBTYPE, IMAGE_STORE_LABEL);
+    if (!partition)
+    {
+        Log_info("Image store: no '%s' partition, using SPIFFS cache", IMAGE_STORE_LABEL);
+        return false;
+    }
+
+    slot_count = partition->size / IMAGE_STORE_SLOT_SIZE;
+    if (slot_count > IMAGE_STORE_MAX_SLOTS)
+        slot_count = IMAGE_STORE_MAX_SLOTS;
+    if (slot_count < 2)
+    {
+        Log_error("Image store: partition too small (%d bytes)", partition->size);
+        partition = nullptr;
+        return false;
+    }
+
+    int used = 0;
+    for (int i = 0; i < slot_count; i++)
+    {
+        if (esp_partition_read(partition, slot_offset(i), &slots[i], sizeof(ImageSlotHeader)) != ESP_OK)
+            memset(&slots[i], 0xFF, sizeof(ImageSlotHeader));  // treat as unused
+        else if (image_slot_valid(slots[i], IMAGE_STORE_SLOT_SIZE))
+            used++;
+    }
+    Log_info("Image store: %d/%d slots in use", used, slot_count);
+    return true;
+}
+
+bool image_store_lookup(uint32_t key, ImageSlotHeader &out)
+{
+    if (!image_store_init())
+        return false;
+    int slot = image_slots_find(slots, slot_count, IMAGE_STORE_SLOT_SIZE, key);
+    if (slot < 0)
+        return false;
+    out = slots[slot];
+    return true;
+}
+
+const uint8_t *image_store_map(uint32_t key, size_t *size_out)
+{
+    if (!size_out || !image_store_init() || write_slot >= 0)
+        return nullptr;
+    int slot = image_slots_find(slots, slot_count, IMAGE_STORE_SLOT_SIZE, key);
+    if (slot < 0)
+        return nullptr;
+
+    unmap();
+    const void *ptr = nullptr;
+    esp_err_t err = esp_partition_mmap(partition, slot_offset(slot), IMAGE_STORE_SLOT_SIZE,
+                                       SPI_FLASH_MMAP_DATA, &ptr, &map_handle);
+    if (err != ESP_OK)
+    {
+        Log_error("Image store: mmap of slot %d failed (%d)", slot, err);
+        return nullptr;
+    }
+    mapped = true;
+    *size_out = slots[slot].size;
+    return (const uint8_t *)ptr + IMAGE_SLOT_HEADER_SIZE;
+}
+
+bool image_store_begin(uint32_t key, const uint8_t *hash, size_t len)
+{
+    if (!hash || len == 0 || !image_store_init())
+        return false;
+    image_store_abort();
+    if (len > IMAGE_STORE_SLOT_SIZE - IMAGE_SLOT_HEADER_SIZE)
+    {
+        Log_info("Image store: %d bytes exceeds a slot", len);
+        return false;
+    }
+
+    int slot = image_slots_pick(slots, slot_count, IMAGE_STORE_SLOT_SIZE, key);
+    if (slot < 0)
+        return false;
+
+    // Erasing may move flash under an existing mapping — drop it first
+    unmap();
+    uint32_t erases = slots[slot].erase_count == 0xFFFFFFFF ? 0 : slots[slot].erase_count;
+    size_t erase_len = (IMAGE_SLOT_HEADER_SIZE + len + SECTOR_SIZE - 1) / SECTOR_SIZE * SECTOR_SIZE;
+    esp_err_t err = esp_partition_erase_range(partition, slot_offset(slot), erase_len);
+    // The old header is gone either way
+    memset(&slots[slot], 0xFF, sizeof(ImageSlotHeader));
+    if (err != ESP_OK)
+    {
+        Log_error("Image store: erase of slot %d failed (%d)", slot, err);
+        return false;
+    }
+
+    memset(&write_header, 0, sizeof(write_header));
+    write_header.magic = IMAGE_SLOT_MAGIC;
+    write_header.seq = image_slots_next_seq(slots, slot_count, IMAGE_STORE_SLOT_SIZE);
+    write_header.key = key;
+    write_header.size = len;
+    memcpy(write_header.hash, hash, FRAME_HASH_SIZE);
+    write_header.erase_count = erases + 1;
+    slots[slot].erase_count = write_header.erase_count;  // remembered even if the write is abandoned
+    write_slot = slot;
+    write_pos = 0;
+    return true;
+}
+
+bool image_store_append(const uint8_t *data, size_t len)
+{
+    if (write_slot < 0)
+        return false;
+    if (write_pos + len > write_header.size ||
+        esp_partition_write(partition, slot_offset(write_slot) + IMAGE_SLOT_HEADER_SIZE + write_pos,
+                            data, len) != ESP_OK)
+    {
+        Log_error("Image store: write to slot %d failed", write_slot);
+        image_store_abort();
+        return false;
+    }
+    write_pos += len;
+    return true;
+}
+
+bool image_store_commit()
+{
+    if (write_slot < 0)
+        return false;
+    if (write_pos != write_header.size)
+    {
+        image_store_abort();
+        return false;
+    }
+
+    // Everything but the magic, then the magic: a power cut in between
+    // leaves a slot that reads as unused
+    size_t base = slot_offset(write_slot);
+    const uint8_t *raw = (const uint8_t *)&write_header;
+    bool ok = esp_partition_write(partition, base + sizeof(uint32_t), raw + sizeof(uint32_t),
+                                  sizeof(ImageSlotHeader) - sizeof(uint32_t)) == ESP_OK &&
+              esp_partition_write(partition, base, raw, sizeof(uint32_t)) == ESP_OK;
+    if (!ok)
+    {
+        Log_error("Image store: header write to slot %d failed", write_slot);
+        image_store_abort();
+        return false;
+    }
+
+    slots[write_slot] = write_header;
+    Log_info("Image store: slot %d seq %u (%d bytes, erase #%u)", write_slot, write_header.seq,
+             write_header.size, write_header.erase_count);
+    write_slot = -1;
+    return true;
+}
+
+void image_store_abort()
+{
+    // Nothing to undo: without its magic the slot is ignored and picked first next time
+    write_slot = -1;
+    write_pos = 0;
+}
@@ -0,0 +1,341 @@
+#include "image_stream.h"
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <PNGdec.h>
+#include <JPEGDEC.h>
+#include <trmnl_log.h>
+#include <new>
+#include "crypto.h"
+#include "delta.h"
+#include "frame_cache.h"
+#include "github_client.h"
+#include "display_direct.h"
+
+#define SPOOL_PATH "/img_spool"
+
+// Open spool for the decoder callbacks; decoders keep their own copy of the
+// handle, the position lives here so seeks never touch the file
+struct SpoolHandle
+{
+    File file;
+    Aes256CbcReader reader;
+    size_t pos;
+};
+
+// Valid for the duration of one decode
+static const uint8_t *decode_key = nullptr;
+static uint8_t *decode_framebuffer = nullptr;
+static int decode_level_bit = IMAGE_STREAM_HIGH_BIT;
+static uint8_t decode_levels = 0;
+static uint16_t line_rgb565[DISPLAY_DIRECT_WIDTH];
+
+#define JPEG_DITHER_BYTES (DISPLAY_DIRECT_WIDTH * 16)  // JPEGDEC's error buffer, one MCU row
+
+static bool fetch_file(size_t offset, uint8_t *buf, size_t len, void *ctx)
+{
+    File *f = (File *)ctx;
+    return f->seek(offset) && f->read(buf, len) == len;
+}
+
+static SpoolHandle *spool_open()
+{
+    SpoolHandle *h = new SpoolHandle();
+    h->file = SPIFFS.open(SPOOL_PATH, "r");
+    if (!h->file || !aes256_cbc_reader_open(h->reader, decode_key, h->file.size(), fetch_file, &h->file))
+    {
+        Log_error("Image spool: cannot open or decrypt %s", SPOOL_PATH);
+        if (h->file)
+            h->file.close();
+        delete h;
+        return nullptr;
+    }
+    return h;
+}
+
+static void spool_close(SpoolHandle *h)
+{
+    if (!h)
+        return;
+    aes256_cbc_reader_close(h->reader);
+    h->file.close();
+    delete h;
+}
+
+static int32_t spool_read(SpoolHandle *h, uint8_t *buf, int32_t len)
+{
+    int32_t n = aes256_cbc_reader_read(h->reader, h->pos, buf, len);
+    if (n <= 0)
+        return 0;
+    h->pos += n;
+    return n;
+}
+
+// ---- Decoder file callbacks (same shape for PNGdec and JPEGDEC) ----
+
+static void *cb_open(const char *, int32_t *size)
+{
+    SpoolHandle *h = spool_open();
+    if (h)
+        *size = (int32_t)h->reader.plain_len;
+    return h;
+}
+
+static void cb_close(void *handle)
+{
+    spool_close((SpoolHandle *)handle);
+}
+
+static int32_t png_read(PNGFILE *file, uint8_t *buf, int32_t len)
+{
+    return spool_read((SpoolHandle *)file->fHandle, buf, len);
+}
+
+static int32_t png_seek(PNGFILE *file, int32_t pos)
+{
+    ((SpoolHandle *)file->fHandle)->pos = pos;
+    return pos;
+}
+
+static int32_t jpeg_read(JPEGFILE *file, uint8_t *buf, int32_t len)
+{
+    return spool_read((SpoolHandle *)file->fHandle, buf, len);
+}
+
+static int32_t jpeg_seek(JPEGFILE *file, int32_t pos)
+{
+    ((SpoolHandle *)file->fHandle)->pos = pos;
+    return pos;
+}
+
+// ---- Pixels into the 1-bpp plane ----
+
+static inline void put_pixel(int x, int y, bool white)
+{
+    uint8_t *p = decode_framebuffer + y * (DISPLAY_DIRECT_WIDTH / 8) + (x >> 3);
+    uint8_t bit = 0x80 >> (x & 7);
+    if (white)
+        *p |= bit;
+    else
+        *p &= ~bit;
+}
+
+static int png_draw(PNGDRAW *draw)
+{
+    PNG *png = (PNG *)draw->pUser;
+    // Any pixel type (palette, gray, alpha) normalised by the library
+    png->getLineAsRGB565(draw, line_rgb565, PNG_RGB565_LITTLE_ENDIAN, 0xffffffff);
+    for (int x = 0; x < draw->iWidth; x++)
+    {
+        uint16_t c = line_rgb565[x];
+        uint32_t r = ((c >> 11) << 3) | (c >> 13);
+        uint32_t g = (((c >> 5) & 0x3F) << 2) | ((c >> 9) & 0x03);
+        uint32_t b = ((c & 0x1F) << 3) | ((c >> 2) & 0x07);
+        // 2-bpp level as ReduceBpp() makes it; its high bit is the 128 threshold
+        uint8_t level = (uint8_t)((r * 299 + g * 587 + b * 114) / 1000) >> 6;
+        decode_levels |= 1 << level;
+        put_pixel(x, draw->y, (level >> decode_level_bit) & 1);
+    }
+    return 1;
+}
+
+static int jpeg_draw(JPEGDRAW *draw)
+{
+    // ONE_BIT_DITHERED: packed rows, MSB = leftmost pixel, 1 = white
+    const uint8_t *bits = (const uint8_t *)draw->pPixels;
+    int pitch = (draw->iWidth + 7) / 8;
+    for (int y = 0; y < draw->iHeight && draw->y + y < DISPLAY_DIRECT_HEIGHT; y++)
+    {
+        const uint8_t *row = bits + y * pitch;
+        for (int x = 0; x < draw->iWidth && draw->x + x < DISPLAY_DIRECT_WIDTH; x++)
+            put_pixel(draw->x + x, draw->y + y, (row[x >> 3] & (0x80 >> (x & 7))) != 0);
+    }
+    return 1;
+}
+
+static bool decode_png(Arena &arena)
+{
+    void *mem = arena_alloc(arena, sizeof(PNG));
+    if (!mem)
+    {
+        Log_error("No memory for PNG decoder (%d bytes)", sizeof(PNG));
+        return false;
+    }
+    PNG *png = new (mem) PNG();
+    bool ok = png->open(SPOOL_PATH, cb_open, cb_close, png_read, png_seek, png_draw) == PNG_SUCCESS;
+    if (ok && (png->getWidth() != DISPLAY_DIRECT_WIDTH || png->getHeight() != DISPLAY_DIRECT_HEIGHT))
+    {
+        Log_error("PNG is %dx%d, panel is %dx%d", png->getWidth(), png->getHeight(),
+                  DISPLAY_DIRECT_WIDTH, DISPLAY_DIRECT_HEIGHT);
+        ok = false;
+    }
+    if (ok)
+        ok = png->decode(png, 0) == PNG_SUCCESS;
+    else
+        Log_error("PNG open failed (%d)", png->getLastError());
+    png->close();
+    png->~PNG();
+    return ok;
+}
+
+static bool decode_jpeg(Arena &arena)
+{
+    void *mem = arena_alloc(arena, sizeof(JPEGDEC));
+    uint8_t *dither = (uint8_t *)arena_alloc(arena, JPEG_DITHER_BYTES);
+    if (!mem || !dither)
+    {
+        Log_error("No memory for JPEG decoder (%d bytes)", sizeof(JPEGDEC) + JPEG_DITHER_BYTES);
+        return false;
+    }
+    JPEGDEC *jpeg = new (mem) JPEGDEC();
+    bool ok = jpeg->open(SPOOL_PATH, cb_open, cb_close, jpeg_read, jpeg_seek, jpeg_draw) != 0;
+    if (ok && (jpeg->getWidth() != DISPLAY_DIRECT_WIDTH || jpeg->getHeight() != DISPLAY_DIRECT_HEIGHT))
+    {
+        Log_error("JPEG is %dx%d, panel is %dx%d", jpeg->getWidth(), jpeg->getHeight(),
+                  DISPLAY_DIRECT_WIDTH, DISPLAY_DIRECT_HEIGHT);
+        ok = false;
+    }
+    if (ok)
+    {
+        // bb_epaper boards get 1-bit dithered JPEGs from jpeg_to_epd() too
+        jpeg->setPixelType(ONE_BIT_DITHERED);
+        ok = jpeg->decodeDither(dither, 0) != 0;
+    }
+    else
+    {
+        Log_error("JPEG open failed (%d)", jpeg->getLastError());
+    }
+    jpeg->close();
+    jpeg->~JPEGDEC();
+    return ok;
+}
+
+// ---- Public API ----
+
+struct SpoolWriter
+{
+    File file;
+    size_t written;
+    bool write_failed;
+};
+
+static bool spool_chunk(const uint8_t *data, size_t len, void *ctx)
+{
+    SpoolWriter *w = (SpoolWriter *)ctx;
+    if (w->file.write(data, len) != len)
+    {
+        w->write_failed = true;
+        return false;
+    }
+    w->written += len;
+    return true;
+}
+
+bool image_stream_reserve(size_t enc_size)
+{
+    if (!SPIFFS.begin(true))
+    {
+        Log_error("Image spool: SPIFFS mount failed");
+        return false;
+    }
+    SPIFFS.remove(SPOOL_PATH);  // left over if a previous wake lost power
+    return frame_cache_make_room(enc_size);
+}
+
+SpoolResult image_stream_spool(const char *url, size_t *out_size)
+{
+    *out_size = 0;
+    SpoolWriter w;
+    w.file = SPIFFS.open(SPOOL_PATH, "w");
+    w.written = 0;
+    w.write_failed = false;
+    if (!w.file)
+    {
+        Log_error("Image spool: cannot open %s for write", SPOOL_PATH);
+        return SPOOL_STORAGE_FAILED;
+    }
+    size_t received = 0;
+    bool ok = https_download_stream(url, spool_chunk, &w, &received);
+    w.file.close();
+    *out_size = w.written;
+    if (ok)
+        return SPOOL_OK;
+
+    SPIFFS.remove(SPOOL_PATH);
+    if (w.write_failed)
+    {
+        Log_error("Image spool: flash write failed after %d bytes", w.written);
+        return SPOOL_STORAGE_FAILED;
+    }
+    return SPOOL_DOWNLOAD_FAILED;
+}
+
+bool image_stream_digest(const uint8_t *key, const char *screen_name, const uint8_t *expected_hash,
+                         uint8_t *hash_out, size_t *plain_size_out)
+{
+    decode_key = key;
+    SpoolHandle *h = spool_open();
+    decode_key = nullptr;
+    if (!h)
+        return false;
+
+    bool caching = expected_hash &&
+                   frame_cache_begin(screen_name, expected_hash, h->reader.plain_len);
+    FrameHasher hasher;
+    frame_hash_begin(hasher);
+    uint8_t chunk[AES_READER_WINDOW];
+    int32_t n;
+    while ((n = spool_read(h, chunk, sizeof(chunk))) > 0)
+    {
+        frame_hash_update(hasher, chunk, n);
+        if (caching)
+            caching = frame_cache_append(chunk, n);
+    }
+    bool ok = h->pos == h->reader.plain_len;
+    frame_hash_finish(hasher, hash_out);
+    *plain_size_out = h->reader.plain_len;
+    spool_close(h);
+
+    if (caching && ok)
+        frame_cache_commit(hash_out);  // rejects a hash mismatch itself
+    else
+        frame_cache_abort();
+    return ok;
+}
+
+bool image_stream_decode(ImageFormat format, const uint8_t *key, uint8_t *framebuffer, Arena &arena,
+                         int level_bit, uint8_t *levels_out)
+{
+    memset(framebuffer, 0xFF, DISPLAY_DIRECT_FRAME_BYTES);
+    decode_key = key;
+    decode_framebuffer = framebuffer;
+    decode_level_bit = level_bit;
+    decode_levels = 0;
+    bool ok = false;
+    if (format == IMAGE_FORMAT_PNG)
+    {
+        ok = decode_png(arena);
+    }
+    else if (format == IMAGE_FORMAT_JPEG)
+    {
+        ok = decode_jpeg(arena);
+        decode_levels = 0x09;  // dithered: black and white only
+    }
+    if (levels_out)
+        *levels_out = decode_levels;
+    decode_key = nullptr;
+    decode_framebuffer = nullptr;
+    return ok;
+}
+
+bool image_stream_is_gray(uint8_t levels)
+{
+    int count = 0;
+    for (int i = 0; i < 4; i++)
+        count += (levels >> i) & 1;
+    return count > 2;
+}
+
+void image_stream_discard()
+{
+    SPIFFS.remove(SPOOL_PATH);
+}
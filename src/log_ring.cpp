@@ -0,0 +1,426 @@
+#include "log_ring.h"
+#include <cstdio>
+#include <cstring>
+
+// Record: header, then each captured argument in format order. Integers and
+// pointers are stored at their native width, %s as a length byte + bytes.
+struct RecordHeader
+{
+    uint16_t len;       // whole record, header included
+    uint8_t level;
+    uint8_t nargs;      // values captured, '*' widths count as one each
+    uint16_t wake;
+    uint32_t time_ms;
+    int32_t line;
+    const char *file;
+    const char *format;
+};
+
+enum ArgType
+{
+    ARG_NONE,       // "%%"
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_SIZE,
+    ARG_DOUBLE,
+    ARG_PTR,
+    ARG_STR,
+    ARG_UNSUPPORTED
+};
+
+struct Spec
+{
+    const char *start;  // the '%'
+    const char *end;    // one past the conversion character
+    ArgType type;
+    int stars;          // '*' width/precision, each an int argument
+};
+
+static_assert(sizeof(RecordHeader) <= 32, "LOG_RING_RECORD_MAX assumes a 32-byte header at most");
+#define SPEC_MAX 32
+
+// ---- Format scanning ----
+
+// p points at '%'
+static Spec parse_spec(const char *p)
+{
+    Spec s = {p, p + 1, ARG_UNSUPPORTED, 0};
+    const char *q = p + 1;
+
+    while (*q && strchr("-+ #0", *q))
+        q++;
+    if (*q == '*')
+    {
+        s.stars++;
+        q++;
+    }
+    while (*q >= '0' && *q <= '9')
+        q++;
+    if (*q == '.')
+    {
+        q++;
+        if (*q == '*')
+        {
+            s.stars++;
+            q++;
+        }
+        while (*q >= '0' && *q <= '9')
+            q++;
+    }
+
+    int longs = 0;
+    bool size = false;
+    while (*q && strchr("hlLjzt", *q))
+    {
+        if (*q == 'l')
+            longs++;
+        else if (*q == 'j')
+            longs = 2;
+        else if (*q == 'z' || *q == 't')
+            size = true;
+        else if (*q == 'L')
+            longs = 3;
+        q++;
+    }
+
+    char conv = *q;
+    if (!conv)
+    {
+        s.end = q;
+        return s;
+    }
+    s.end = q + 1;
+
+    switch (conv)
+    {
+    case '%':
+        s.type = ARG_NONE;
+        break;
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+        if (size)
+            s.type = ARG_SIZE;
+        else if (longs == 1)
+            s.type = ARG_LONG;
+        else if (longs == 2)
+            s.type = ARG_LLONG;
+        else if (longs == 0)
+            s.type = ARG_INT;
+        break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        if (longs != 3)
+            s.type = ARG_DOUBLE;
+        break;
+    case 's':
+        if (longs == 0)
+            s.type = ARG_STR;
+        break;
+    case 'p':
+        s.type = ARG_PTR;
+        break;
+    }
+    return s;
+}
+
+static size_t arg_size(ArgType type)
+{
+    switch (type)
+    {
+    case ARG_INT:    return sizeof(int);
+    case ARG_LONG:   return sizeof(long);
+    case ARG_LLONG:  return sizeof(long long);
+    case ARG_SIZE:   return sizeof(size_t);
+    case ARG_DOUBLE: return sizeof(double);
+    case ARG_PTR:    return sizeof(void *);
+    default:         return 0;
+    }
+}
+
+// ---- Ring byte access ----
+
+static void ring_write(LogRing &ring, size_t off, const uint8_t *src, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ring.data[(off + i) % LOG_RING_SIZE] = src[i];
+}
+
+static void ring_read(const LogRing &ring, size_t off, uint8_t *dst, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        dst[i] = ring.data[(off + i) % LOG_RING_SIZE];
+}
+
+static uint16_t record_len(const LogRing &ring, size_t off)
+{
+    uint16_t len;
+    ring_read(ring, off, (uint8_t *)&len, sizeof(len));
+    return len;
+}
+
+static void drop_oldest(LogRing &ring)
+{
+    uint16_t len = record_len(ring, ring.head);
+    ring.head = (ring.head + len) % LOG_RING_SIZE;
+    ring.used -= len;
+    ring.dropped++;
+}
+
+// ---- Public API ----
+
+void log_ring_reset(LogRing &ring, uint32_t image)
+{
+    ring.magic = LOG_RING_MAGIC;
+    ring.image = image;
+    ring.head = 0;
+    ring.used = 0;
+    ring.dropped = 0;
+    ring.wake = 0;
+}
+
+bool log_ring_valid(const LogRing &ring, uint32_t image)
+{
+    if (ring.magic != LOG_RING_MAGIC || ring.image != image || ring.head >= LOG_RING_SIZE || ring.used > LOG_RING_SIZE)
+        return false;
+
+    size_t off = ring.head;
+    size_t left = ring.used;
+    while (left > 0)
+    {
+        uint16_t len = record_len(ring, off);
+        if (len < sizeof(RecordHeader) || len > left)
+            return false;
+        off += len;
+        left -= len;
+    }
+    return true;
+}
+
+size_t log_ring_encode(uint8_t *rec, uint8_t level, uint32_t time_ms,
+                       const char *file, int line, const char *format, va_list args)
+{
+    size_t n = sizeof(RecordHeader);
+    int nargs = 0;
+
+    for (const char *p = format; *p; p++)
+    {
+        if (*p != '%')
+            continue;
+        Spec s = parse_spec(p);
+        p = s.end - 1;
+        if (s.type == ARG_NONE)
+            continue;
+        // Arguments after an unknown conversion can't be located
+        if (s.type == ARG_UNSUPPORTED || nargs + s.stars + 1 > LOG_RING_MAX_ARGS)
+            break;
+
+        for (int i = 0; i < s.stars; i++)
+        {
+            int v = va_arg(args, int);
+            memcpy(rec + n, &v, sizeof(v));
+            n += sizeof(v);
+        }
+
+        switch (s.type)
+        {
+        case ARG_INT:    { int v = va_arg(args, int);             memcpy(rec + n, &v, sizeof(v)); break; }
+        case ARG_LONG:   { long v = va_arg(args, long);           memcpy(rec + n, &v, sizeof(v)); break; }
+        case ARG_LLONG:  { long long v = va_arg(args, long long); memcpy(rec + n, &v, sizeof(v)); break; }
+        case ARG_SIZE:   { size_t v = va_arg(args, size_t);       memcpy(rec + n, &v, sizeof(v)); break; }
+        case ARG_DOUBLE: { double v = va_arg(args, double);       memcpy(rec + n, &v, sizeof(v)); break; }
+        case ARG_PTR:    { void *v = va_arg(args, void *);        memcpy(rec + n, &v, sizeof(v)); break; }
+        case ARG_STR:
+        {
+            // Copied: callers often pass stack buffers or String::c_str()
+            const char *v = va_arg(args, const char *);
+            if (!v)
+                v = "(null)";
+            size_t len = strnlen(v, LOG_RING_MAX_STR);
+            rec[n++] = (uint8_t)len;
+            memcpy(rec + n, v, len);
+            n += len;
+            break;
+        }
+        default:
+            break;
+        }
+        n += arg_size(s.type);
+        nargs += s.stars + 1;
+    }
+
+    RecordHeader h;
+    memset(&h, 0, sizeof(h));
+    h.len = (uint16_t)n;
+    h.level = level;
+    h.nargs = (uint8_t)nargs;
+    h.time_ms = time_ms;
+    h.line = line;
+    h.file = file;
+    h.format = format;
+    memcpy(rec, &h, sizeof(h));
+    return n;
+}
+
+bool log_ring_push(LogRing &ring, uint8_t *rec, size_t len)
+{
+    if (len < sizeof(RecordHeader) || len > LOG_RING_SIZE)
+        return false;
+
+    RecordHeader h;
+    memcpy(&h, rec, sizeof(h));
+    h.wake = ring.wake;
+    memcpy(rec, &h, sizeof(h));
+
+    while (ring.used + len > LOG_RING_SIZE)
+        drop_oldest(ring);
+    ring_write(ring, ring.head + ring.used, rec, len);
+    ring.used += len;
+    return true;
+}
+
+size_t log_ring_take(LogRing &ring, uint8_t *rec)
+{
+    if (ring.used == 0)
+        return 0;
+
+    uint16_t len = record_len(ring, ring.head);
+    if (len < sizeof(RecordHeader) || len > LOG_RING_RECORD_MAX)
+    {
+        // Can't come from log_ring_encode(); don't trust the rest either
+        log_ring_reset(ring, ring.image);
+        return 0;
+    }
+    ring_read(ring, ring.head, rec, len);
+    ring.head = (ring.head + len) % LOG_RING_SIZE;
+    ring.used -= len;
+    return len;
+}
+
+void log_ring_format(const uint8_t *rec, size_t len, LogRingEntry &entry, char *msg, size_t msg_size)
+{
+    memset(&entry, 0, sizeof(entry));
+    if (msg_size)
+        msg[0] = '\0';
+    if (len < sizeof(RecordHeader))
+        return;
+
+    RecordHeader h;
+    memcpy(&h, rec, sizeof(h));
+    entry.level = h.level;
+    entry.wake = h.wake;
+    entry.time_ms = h.time_ms;
+    entry.file = h.file;
+    entry.line = h.line;
+
+    size_t out = 0;
+    size_t in = sizeof(h);
+    int args_left = h.nargs;
+    if (msg_size == 0)
+        return;
+
+    for (const char *p = h.format; *p && out + 1 < msg_size; p++)
+    {
+        if (*p != '%')
+        {
+            msg[out++] = *p;
+            continue;
+        }
+
+        Spec s = parse_spec(p);
+        p = s.end - 1;
+        if (s.type == ARG_NONE)
+        {
+            msg[out++] = '%';
+            continue;
+        }
+        size_t spec_len = s.end - s.start;
+        if (args_left < s.stars + 1 || spec_len + 2 * 11 >= SPEC_MAX)
+        {
+            msg[out++] = '?';
+            continue;
+        }
+
+        // A damaged record can claim more arguments or longer strings than it
+        // holds; stop reading at its end
+        size_t need = s.stars * sizeof(int) + arg_size(s.type);
+        size_t str_len = 0;
+        if (s.type == ARG_STR)
+        {
+            size_t at = in + s.stars * sizeof(int);
+            str_len = at < len ? rec[at] : LOG_RING_MAX_STR + 1;
+            need += 1 + str_len;
+        }
+        if (str_len > LOG_RING_MAX_STR || in + need > len)
+        {
+            args_left = 0;
+            msg[out++] = '?';
+            continue;
+        }
+
+        // Rebuild the conversion with each '*' replaced by its stored value
+        char spec[SPEC_MAX];
+        size_t sn = 0;
+        for (const char *c = s.start; c < s.end; c++)
+        {
+            if (*c == '*')
+            {
+                int v;
+                memcpy(&v, rec + in, sizeof(v));
+                in += sizeof(v);
+                sn += snprintf(spec + sn, SPEC_MAX - sn, "%d", v);
+            }
+            else
+            {
+                spec[sn++] = *c;
+            }
+        }
+        spec[sn] = '\0';
+        args_left -= s.stars + 1;
+
+        char *dst = msg + out;
+        size_t room = msg_size - out;
+        int w = 0;
+        switch (s.type)
+        {
+        case ARG_INT:    { int v;       memcpy(&v, rec + in, sizeof(v)); w = snprintf(dst, room, spec, v); break; }
+        case ARG_LONG:   { long v;      memcpy(&v, rec + in, sizeof(v)); w = snprintf(dst, room, spec, v); break; }
+        case ARG_LLONG:  { long long v; memcpy(&v, rec + in, sizeof(v)); w = snprintf(dst, room, spec, v); break; }
+        case ARG_SIZE:   { size_t v;    memcpy(&v, rec + in, sizeof(v)); w = snprintf(dst, room, spec, v); break; }
+        case ARG_DOUBLE: { double v;    memcpy(&v, rec + in, sizeof(v)); w = snprintf(dst, room, spec, v); break; }
+        case ARG_PTR:    { void *v;     memcpy(&v, rec + in, sizeof(v)); w = snprintf(dst, room, spec, v); break; }
+        case ARG_STR:
+        {
+            char v[LOG_RING_MAX_STR + 1];
+            uint8_t n = rec[in++];
+            memcpy(v, rec + in, n);
+            v[n] = '\0';
+            in += n;
+            w = snprintf(dst, room, spec, v);
+            break;
+        }
+        default:
+            break;
+        }
+        in += arg_size(s.type);
+        if (w > 0)
+            out += ((size_t)w < room) ? (size_t)w : room - 1;
+    }
+    msg[out] = '\0';
+}
+
+bool log_ring_vrecord(LogRing &ring, uint8_t level, uint32_t time_ms,
+                      const char *file, int line, const char *format, va_list args)
+{
+    uint8_t rec[LOG_RING_RECORD_MAX];
+    size_t len = log_ring_encode(rec, level, time_ms, file, line, format, args);
+    return log_ring_push(ring, rec, len);
+}
+
+bool log_ring_pop(LogRing &ring, LogRingEntry &entry, char *msg, size_t msg_size)
+{
+    uint8_t rec[LOG_RING_RECORD_MAX];
+    size_t len = log_ring_take(ring, rec);
+    if (len == 0)
+        return false;
+    log_ring_format(rec, len, entry, msg, msg_size);
+    return true;
+}
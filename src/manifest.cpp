@@ -1,13 +1,54 @@
 #include "manifest.h"
 #include <ArduinoJson.h>
 #include <trmnl_log.h>
+#include <cstring>
 
-bool parse_manifest(const uint8_t *json, size_t len, Manifest &out)
+// Routes the JSON document's pool into an arena. Each block carries its size
+// so reallocate() can copy; nothing is freed until the caller rewinds.
+class ArenaJsonAllocator : public ArduinoJson::Allocator
 {
-    if (!json || len == 0)
-        return false;
+public:
+    explicit ArenaJsonAllocator(Arena &arena) : arena_(arena) {}
 
-    JsonDocument doc;
+    void *allocate(size_t size) override
+    {
+        uint8_t *p = (uint8_t *)arena_alloc(arena_, size + ARENA_ALIGN);
+        if (!p)
+            return nullptr;
+        memcpy(p, &size, sizeof(size));
+        return p + ARENA_ALIGN;
+    }
+
+    void deallocate(void *) override {}
+
+    void *reallocate(void *ptr, size_t new_size) override
+    {
+        if (!ptr)
+            return allocate(new_size);
+        size_t old_size;
+        memcpy(&old_size, (uint8_t *)ptr - ARENA_ALIGN, sizeof(old_size));
+        if (new_size <= old_size)
+            return ptr;
+        void *p = allocate(new_size);
+        if (p)
+            memcpy(p, ptr, old_size);
+        return p;
+    }
+
+private:
+    Arena &arena_;
+};
+
+// String assignment fails silently when the heap runs out and leaves an
+// empty string; a screen without its filename or hash must not get through
+static bool copy_string(String &dst, const char *src)
+{
+    dst = src;
+    return dst.c_str() && dst.length() == strlen(src);
+}
+
+static bool parse_document(JsonDocument &doc, const uint8_t *json, size_t len, Manifest &out)
+{
     DeserializationError err = deserializeJson(doc, (const char *)json, len);
 
     if (err)
@@ -18,7 +59,15 @@ bool parse_manifest(const uint8_t *json, size_t len, Manifest &out)
 
     out.version = doc["version"] | 0;
     out.refresh_rate = doc["refresh_rate"] | 1800;
-    out.updated_at = doc["updated_at"] | "";
+    bool copied = copy_string(out.updated_at, doc["updated_at"] | "");
+
+    out.mirror_count = 0;
+    for (JsonVariant mirror : doc["mirrors"].as<JsonArray>())
+    {
+        const char *url = mirror | "";
+        if (*url && out.mirror_count < MANIFEST_MAX_MIRRORS)
+            copied = copy_string(out.mirrors[out.mirror_count++], url) && copied;
+    }
 
     JsonArray screens = doc["screens"];
     if (screens.isNull())
@@ -37,12 +86,25 @@ bool parse_manifest(const uint8_t *json, size_t len, Manifest &out)
         }
 
         ManifestScreen &s = out.screens[out.screen_count];
-        s.name = screen["name"] | "";
-        s.filename = screen["filename"] | "";
+        copied = copy_string(s.name, screen["name"] | "") && copied;
+        copied = copy_string(s.filename, screen["filename"] | "") && copied;
         s.size = screen["size"] | 0;
+        s.format = image_format_from_name(screen["format"] | "");
+        copied = copy_string(s.hash, screen["hash"] | "") && copied;
+
+        JsonObject delta = screen["delta"];
+        copied = copy_string(s.delta_filename, delta["filename"] | "") && copied;
+        copied = copy_string(s.delta_base, delta["base"] | "") && copied;
+        s.delta_size = delta["size"] | 0;
         out.screen_count++;
     }
 
+    if (!copied)
+    {
+        Log_error("Manifest: out of memory copying strings");
+        return false;
+    }
+
     if (out.screen_count == 0)
     {
         Log_error("Manifest has no screens");
@@ -52,3 +114,18 @@ bool parse_manifest(const uint8_t *json, size_t len, Manifest &out)
     Log_info("Manifest: v%d, %d screens, refresh %ds", out.version, out.screen_count, out.refresh_rate);
     return true;
 }
+
+bool parse_manifest(const uint8_t *json, size_t len, Manifest &out, Arena *scratch)
+{
+    if (!json || len == 0)
+        return false;
+
+    if (scratch)
+    {
+        ArenaJsonAllocator allocator(*scratch);
+        JsonDocument doc(&allocator);
+        return parse_document(doc, json, len, out);
+    }
+    JsonDocument doc;
+    return parse_document(doc, json, len, out);
+}
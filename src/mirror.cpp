@@ -0,0 +1,105 @@
+#include "mirror.h"
+#include "github_client.h"
+#include <trmnl_log.h>
+
+RTC_DATA_ATTR static MirrorStats rtc_stats;
+
+void mirror_begin()
+{
+    if (!mirror_stats_valid(rtc_stats))
+        mirror_stats_reset(rtc_stats);
+    mirror_stats_tick(rtc_stats);
+    mirror_stats_seal(rtc_stats);
+}
+
+int mirror_set_add(MirrorSet &set, const String &list)
+{
+    int start = 0;
+    int len = list.length();
+    while (start < len)
+    {
+        int end = start;
+        while (end < len && !strchr(" \t,;", list[end]))
+            end++;
+        if (end > start && set.count < MIRROR_MAX)
+        {
+            String origin = list.substring(start, end);
+            bool known = false;
+            for (int i = 0; i < set.count; i++)
+                known = known || set.origins[i] == origin;
+            if (!known)
+            {
+                set.origins[set.count] = origin;
+                set.keys[set.count] = mirror_origin_key(origin.c_str());
+                set.count++;
+            }
+        }
+        start = end + 1;
+    }
+    return set.count;
+}
+
+bool mirror_fetch(const MirrorSet &set, const char *path, mirror_fetch_fn fn, void *ctx)
+{
+    int order[MIRROR_MAX];
+    mirror_rank(rtc_stats, set.keys, set.count, order);
+
+    for (int i = 0; i < set.count; i++)
+    {
+        int o = order[i];
+        bool last = i == set.count - 1;
+        String url = set.origins[o] + path;
+        uint32_t timeout = mirror_timeout_ms(rtc_stats, set.keys[o], last);
+        if (set.count > 1)
+            Log_info("Mirror %d/%d: %s (timeout %ums)", i + 1, set.count, url.c_str(),
+                     (unsigned)(timeout ? timeout : HTTPS_TIMEOUT_MS));
+
+        size_t delivered = 0;
+        https_set_timeout(timeout);
+        bool ok = fn(url.c_str(), ctx, &delivered);
+        https_set_timeout(0);
+
+        // A failure after data arrived is as likely the consumer's as the
+        // origin's, so only clean failures count against the origin
+        if (ok || delivered == 0)
+        {
+            mirror_stats_record(rtc_stats, set.keys[o], ok, https_last_latency_ms());
+            mirror_stats_seal(rtc_stats);
+        }
+        if (ok)
+            return true;
+        if (delivered > 0)
+        {
+            Log_error("Mirror: %s failed after %d bytes, not retrying elsewhere", url.c_str(), delivered);
+            return false;
+        }
+    }
+    return false;
+}
+
+struct DownloadAttempt
+{
+    Arena *arena;
+    uint8_t *data;
+    size_t size;
+};
+
+static bool download_attempt(const char *url, void *ctx, size_t *delivered)
+{
+    DownloadAttempt *a = (DownloadAttempt *)ctx;
+    size_t mark = arena_mark(*a->arena);
+    a->data = https_download(url, &a->size, *a->arena);
+    if (!a->data)
+        arena_rewind(*a->arena, mark);
+    return a->data != nullptr;
+}
+
+uint8_t *mirror_download(const MirrorSet &set, const char *path, size_t *out_size, Arena &arena)
+{
+    DownloadAttempt a = {&arena, nullptr, 0};
+    *out_size = 0;
+    if (!mirror_fetch(set, path, download_attempt, &a))
+        return nullptr;
+    *out_size = a.size;
+    return a.data;
+}
@@ -0,0 +1,173 @@
+#include "mirror_stats.h"
+#include <cstring>
+
+static uint32_t fnv1a(const uint8_t *p, size_t n, uint32_t h = 2166136261u)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t checksum(const MirrorStats &s)
+{
+    return fnv1a((const uint8_t *)&s, offsetof(MirrorStats, checksum));
+}
+
+static MirrorStat *find_slot(MirrorStats &s, uint32_t key)
+{
+    for (int i = 0; i < MIRROR_STATS_SLOTS; i++)
+        if (s.slots[i].key == key)
+            return &s.slots[i];
+    return nullptr;
+}
+
+// Existing entry, else a free slot, else the one unused the longest
+static MirrorStat &claim_slot(MirrorStats &s, uint32_t key)
+{
+    MirrorStat *slot = find_slot(s, key);
+    if (slot)
+        return *slot;
+
+    slot = &s.slots[0];
+    for (int i = 0; i < MIRROR_STATS_SLOTS; i++)
+    {
+        MirrorStat &c = s.slots[i];
+        if (c.key == 0)
+        {
+            slot = &c;
+            break;
+        }
+        if (c.age > slot->age)
+            slot = &c;
+    }
+    memset(slot, 0, sizeof(*slot));
+    slot->key = key;
+    return *slot;
+}
+
+uint32_t mirror_origin_key(const char *url)
+{
+    // scheme://authority — stop at the first '/' after "//"
+    const char *start = strstr(url, "//");
+    const char *end = start ? strchr(start + 2, '/') : nullptr;
+    size_t len = end ? (size_t)(end - url) : strlen(url);
+
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+    {
+        uint8_t c = (uint8_t)url[i];
+        if (c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';  // hosts and schemes are case-insensitive
+        h = fnv1a(&c, 1, h);
+    }
+    return h ? h : 1;
+}
+
+void mirror_stats_reset(MirrorStats &s)
+{
+    memset(&s, 0, sizeof(s));
+    mirror_stats_seal(s);
+}
+
+bool mirror_stats_valid(const MirrorStats &s)
+{
+    return s.magic == MIRROR_STATS_MAGIC && s.checksum == checksum(s);
+}
+
+void mirror_stats_seal(MirrorStats &s)
+{
+    s.magic = MIRROR_STATS_MAGIC;
+    s.checksum = checksum(s);
+}
+
+void mirror_stats_tick(MirrorStats &s)
+{
+    for (int i = 0; i < MIRROR_STATS_SLOTS; i++)
+    {
+        MirrorStat &e = s.slots[i];
+        if (e.key == 0)
+            continue;
+        if (e.penalty > 0)
+            e.penalty--;
+        if (e.age < 0xFF)
+            e.age++;
+    }
+}
+
+void mirror_stats_record(MirrorStats &s, uint32_t key, bool ok, uint32_t latency_ms)
+{
+    MirrorStat &e = claim_slot(s, key);
+    e.age = 0;
+    if (!ok)
+    {
+        if (e.failures < MIRROR_PENALTY_MAX_SHIFT)
+            e.failures++;
+        e.penalty = (uint8_t)(1 << e.failures);
+        return;
+    }
+
+    e.failures = 0;
+    e.penalty = 0;
+    if (latency_ms < 1)
+        latency_ms = 1;  // 0 means never measured
+    if (latency_ms > 0xFFFF)
+        latency_ms = 0xFFFF;
+    // 3:1 moving average; one slow handshake shouldn't reorder the origins
+    e.latency_ms = e.latency_ms ? (uint16_t)((3u * e.latency_ms + latency_ms) / 4) : (uint16_t)latency_ms;
+}
+
+const MirrorStat *mirror_stats_find(const MirrorStats &s, uint32_t key)
+{
+    return find_slot(const_cast<MirrorStats &>(s), key);
+}
+
+// Lower sorts first: healthy before penalised, then by latency or penalty
+static uint32_t rank_score(const MirrorStats &s, uint32_t key)
+{
+    const MirrorStat *e = mirror_stats_find(s, key);
+    if (!e)
+        return 0;
+    if (e->penalty > 0)
+        return 0x10000u + e->penalty;
+    return e->latency_ms;
+}
+
+void mirror_rank(const MirrorStats &s, const uint32_t *keys, int count, int *order)
+{
+    uint32_t score[MIRROR_MAX];
+    for (int i = 0; i < count && i < MIRROR_MAX; i++)
+    {
+        order[i] = i;
+        score[i] = rank_score(s, keys[i]);
+    }
+    // Insertion sort: stable, and count is tiny
+    for (int i = 1; i < count && i < MIRROR_MAX; i++)
+    {
+        int o = order[i];
+        int j = i - 1;
+        while (j >= 0 && score[order[j]] > score[o])
+        {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = o;
+    }
+}
+
+uint32_t mirror_timeout_ms(const MirrorStats &s, uint32_t key, bool last)
+{
+    if (last)
+        return 0;
+    const MirrorStat *e = mirror_stats_find(s, key);
+    if (!e || e->latency_ms == 0)
+        return MIRROR_MAX_TIMEOUT_MS;
+    uint32_t t = (uint32_t)e->latency_ms * MIRROR_TIMEOUT_FACTOR;
+    if (t < MIRROR_MIN_TIMEOUT_MS)
+        return MIRROR_MIN_TIMEOUT_MS;
+    if (t > MIRROR_MAX_TIMEOUT_MS)
+        return MIRROR_MAX_TIMEOUT_MS;
+    return t;
+}
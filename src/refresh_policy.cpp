@@ -0,0 +1,69 @@
+#include "refresh_policy.h"
+#include <cstring>
+
+RefreshAction refresh_policy_decide(const RefreshState &state, const RefreshRequest &req)
+{
+    if (req.force_full || !state.displayed_valid || !req.target_hash)
+        return REFRESH_ACTION_FULL;
+
+    if (memcmp(state.displayed_hash, req.target_hash, FRAME_HASH_SIZE) == 0)
+        return REFRESH_ACTION_SKIP;
+
+    // Partial only when the panel shows exactly the delta's base (it becomes the
+    // controller's old image) and the producer said how much changed
+    if (!req.partial_capable || !req.delta || !req.delta->has_rects)
+        return REFRESH_ACTION_FULL;
+    if (memcmp(state.displayed_hash, req.delta->base_hash, FRAME_HASH_SIZE) != 0)
+        return REFRESH_ACTION_FULL;
+    if (state.partials_since_full >= REFRESH_MAX_PARTIALS)
+        return REFRESH_ACTION_FULL;
+    if ((uint64_t)delta_rect_area(*req.delta) * 100 > (uint64_t)req.panel_area * REFRESH_MAX_PARTIAL_AREA_PCT)
+        return REFRESH_ACTION_FULL;
+
+    return REFRESH_ACTION_PARTIAL;
+}
+
+PanelRefresh refresh_policy_panel_mode(const RefreshState &state, bool force_full, uint32_t sleep_seconds)
+{
+    if (force_full || state.partials_since_full >= REFRESH_MAX_PARTIALS)
+        return PANEL_REFRESH_FULL;
+    if (sleep_seconds >= REFRESH_FAST_MIN_SLEEP_SECONDS)
+        return PANEL_REFRESH_FAST;
+    return PANEL_REFRESH_PARTIAL;
+}
+
+void refresh_policy_record(RefreshState &state, RefreshAction action, const uint8_t *target_hash)
+{
+    switch (action)
+    {
+    case REFRESH_ACTION_FULL:
+        state.partials_since_full = 0;
+        break;
+    case REFRESH_ACTION_PARTIAL:
+        if (state.partials_since_full < 0xFF)
+            state.partials_since_full++;
+        break;
+    case REFRESH_ACTION_SKIP:
+        return;
+    }
+
+    if (target_hash)
+    {
+        memcpy(state.displayed_hash, target_hash, FRAME_HASH_SIZE);
+        state.displayed_valid = 1;
+    }
+    else
+    {
+        state.displayed_valid = 0;
+    }
+}
+
+const char *refresh_action_name(RefreshAction action)
+{
+    switch (action)
+    {
+    case REFRESH_ACTION_PARTIAL: return "partial";
+    case REFRESH_ACTION_SKIP:   return "skip";
+    default:                    return "full";
+    }
+}
@@ -0,0 +1,175 @@
+#include "stream_pipeline.h"
+#include <Arduino.h>
+#include <trmnl_log.h>
+
+#if defined(STREAM_PIPELINE) && !CONFIG_FREERTOS_UNICORE
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#define PIPELINE_END 0xFF  // queued after the last slot
+
+struct Pipeline
+{
+    https_chunk_fn consume;
+    void *ctx;
+    uint8_t *buffers[PIPELINE_SLOTS];
+    size_t lens[PIPELINE_SLOTS];
+    QueueHandle_t free_q;  // slot indices the network side may fill
+    QueueHandle_t full_q;  // slot indices ready for the consumer, then PIPELINE_END
+    SemaphoreHandle_t done;
+    volatile bool consumer_failed;
+
+    // Network side only
+    int filling;  // slot being filled, -1 if none could be had
+    uint32_t wait_ms;
+    uint32_t chunks;
+};
+
+static void consumer_task(void *arg)
+{
+    Pipeline *p = (Pipeline *)arg;
+    uint8_t idx;
+    while (xQueueReceive(p->full_q, &idx, portMAX_DELAY) == pdTRUE && idx != PIPELINE_END)
+    {
+        // After a failure keep draining so the network side never blocks on us
+        if (!p->consumer_failed && !p->consume(p->buffers[idx], p->lens[idx], p->ctx))
+            p->consumer_failed = true;
+        xQueueSend(p->free_q, &idx, 0);
+    }
+    xSemaphoreGive(p->done);
+    vTaskDelete(nullptr);
+}
+
+static bool push_filled(Pipeline *p)
+{
+    uint8_t idx = (uint8_t)p->filling;
+    p->filling = -1;
+    p->chunks++;
+    return xQueueSend(p->full_q, &idx, 0) == pdTRUE;  // full_q holds every slot plus END
+}
+
+static bool take_free(Pipeline *p)
+{
+    uint8_t idx;
+    unsigned long start = millis();
+    if (xQueueReceive(p->free_q, &idx, pdMS_TO_TICKS(PIPELINE_WAIT_MS)) != pdTRUE)
+    {
+        Log_error("Pipeline: consumer stalled for %dms", PIPELINE_WAIT_MS);
+        return false;
+    }
+    p->wait_ms += millis() - start;
+    p->filling = idx;
+    p->lens[idx] = 0;
+    return true;
+}
+
+// Runs in the network task: pack socket reads into ring slots
+static bool producer_sink(const uint8_t *data, size_t len, void *ctx)
+{
+    Pipeline *p = (Pipeline *)ctx;
+    while (len > 0)
+    {
+        if (p->consumer_failed)
+            return false;
+        if (p->filling < 0 && !take_free(p))
+            return false;
+
+        size_t &used = p->lens[p->filling];
+        size_t n = min(len, (size_t)PIPELINE_SLOT_SIZE - used);
+        memcpy(p->buffers[p->filling] + used, data, n);
+        used += n;
+        data += n;
+        len -= n;
+        if (used == PIPELINE_SLOT_SIZE && !push_filled(p))
+            return false;
+    }
+    return true;
+}
+
+static bool pipeline_start(Pipeline *p, Arena &arena)
+{
+    for (int i = 0; i < PIPELINE_SLOTS; i++)
+    {
+        p->buffers[i] = (uint8_t *)arena_alloc(arena, PIPELINE_SLOT_SIZE);
+        if (!p->buffers[i])
+            return false;
+    }
+
+    p->free_q = xQueueCreate(PIPELINE_SLOTS, sizeof(uint8_t));
+    p->full_q = xQueueCreate(PIPELINE_SLOTS + 1, sizeof(uint8_t));
+    p->done = xSemaphoreCreateBinary();
+    if (!p->free_q || !p->full_q || !p->done)
+        return false;
+    for (uint8_t i = 0; i < PIPELINE_SLOTS; i++)
+        xQueueSend(p->free_q, &i, 0);
+
+    BaseType_t other_core = xPortGetCoreID() == 0 ? 1 : 0;
+    return xTaskCreatePinnedToCore(consumer_task, "pipeline", PIPELINE_TASK_STACK, p,
+                                   uxTaskPriorityGet(nullptr), nullptr, other_core) == pdPASS;
+}
+
+static void pipeline_free(Pipeline *p)
+{
+    if (p->free_q)
+        vQueueDelete(p->free_q);
+    if (p->full_q)
+        vQueueDelete(p->full_q);
+    if (p->done)
+        vSemaphoreDelete(p->done);
+}
+
+bool stream_pipeline_download(const char *url, https_chunk_fn on_chunk, void *ctx,
+                              size_t *out_size, Arena &arena)
+{
+    if (!url || !on_chunk || !out_size)
+        return false;
+
+    size_t mark = arena_mark(arena);
+    Pipeline *p = (Pipeline *)arena_alloc(arena, sizeof(Pipeline));
+    if (p)
+    {
+        memset(p, 0, sizeof(*p));
+        p->consume = on_chunk;
+        p->ctx = ctx;
+        p->filling = -1;
+    }
+    if (!p || !pipeline_start(p, arena))
+    {
+        Log_info("Pipeline: cannot start, downloading in one task");
+        if (p)
+            pipeline_free(p);
+        arena_rewind(arena, mark);
+        return https_download_stream(url, on_chunk, ctx, out_size);
+    }
+
+    unsigned long start = millis();
+    bool downloaded = https_download_stream(url, producer_sink, p, out_size);
+
+    // Hand over the tail, then wait until the consumer is out of on_chunk
+    if (downloaded && p->filling >= 0 && p->lens[p->filling] > 0)
+        downloaded = push_filled(p);
+    uint8_t end = PIPELINE_END;
+    xQueueSend(p->full_q, &end, portMAX_DELAY);
+    xSemaphoreTake(p->done, portMAX_DELAY);
+
+    bool ok = downloaded && !p->consumer_failed;
+    Log_info("Pipeline: %d chunks in %lums, network waited %dms on the consumer",
+             p->chunks, millis() - start, p->wait_ms);
+    pipeline_free(p);
+    arena_rewind(arena, mark);
+    return ok;
+}
+
+#else
+
+bool stream_pipeline_download(const char *url, https_chunk_fn on_chunk, void *ctx,
+                              size_t *out_size, Arena &arena)
+{
+    (void)arena;
+    return https_download_stream(url, on_chunk, ctx, out_size);
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include "timekeeper.h"
+#include <cstring>
+
+static uint32_t checksum(const TimeModel &m)
+{
+    // FNV-1a over the record up to the checksum
+    const uint8_t *p = (const uint8_t *)&m;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < offsetof(TimeModel, checksum); i++)
+    {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static int64_t abs64(int64_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+void time_model_reset(TimeModel &m)
+{
+    memset(&m, 0, sizeof(m));
+    m.drift_uncertainty_ppm = TIME_DRIFT_UNKNOWN_PPM;
+    time_model_seal(m);
+}
+
+bool time_model_valid(const TimeModel &m)
+{
+    return m.magic == TIME_MODEL_MAGIC && m.checksum == checksum(m);
+}
+
+void time_model_seal(TimeModel &m)
+{
+    m.magic = TIME_MODEL_MAGIC;
+    m.checksum = checksum(m);
+}
+
+void time_model_advance(TimeModel &m, int64_t awake_us, int64_t sleep_us)
+{
+    if (awake_us > 0)
+        m.awake_us += awake_us;
+    if (sleep_us > 0)
+        m.sleep_us += sleep_us;
+}
+
+int64_t time_model_now_us(const TimeModel &m, int64_t awake_now_us)
+{
+    int64_t sleep_true = m.sleep_us + m.sleep_us / 1000000 * m.drift_ppm +
+                         m.sleep_us % 1000000 * m.drift_ppm / 1000000;
+    return m.sync_epoch_us + m.awake_us + awake_now_us + sleep_true;
+}
+
+int64_t time_model_error_us(const TimeModel &m, int64_t awake_now_us)
+{
+    int64_t sleep_err = m.sleep_us / 1000000 * m.drift_uncertainty_ppm;
+    int64_t awake_err = (m.awake_us + awake_now_us) / 1000000 * TIME_AWAKE_DRIFT_PPM;
+    return TIME_NTP_ERROR_US + sleep_err + awake_err;
+}
+
+bool time_model_needs_sync(const TimeModel &m, int64_t awake_now_us)
+{
+    if (!m.synced)
+        return true;
+    int64_t age_us = m.awake_us + awake_now_us + m.sleep_us;
+    return age_us >= (int64_t)TIME_MAX_SYNC_AGE_S * 1000000 ||
+           time_model_error_us(m, awake_now_us) > (int64_t)TIME_MAX_ERROR_MS * 1000;
+}
+
+void time_model_sync(TimeModel &m, int64_t ntp_epoch_us, int64_t awake_now_us)
+{
+    if (m.synced && m.sleep_us >= (int64_t)TIME_MIN_LEARN_SLEEP_S * 1000000)
+    {
+        // What the RTC missed over the sleep it timed, relative to its length
+        int64_t missed = ntp_epoch_us - m.sync_epoch_us - m.awake_us - awake_now_us - m.sleep_us;
+        int64_t observed = missed * 1000 / (m.sleep_us / 1000);
+
+        // Sanity bound: a wrong clock or lost sleep accounting, not drift
+        if (abs64(observed) <= TIME_DRIFT_UNKNOWN_PPM)
+        {
+            int64_t residual = abs64(observed - m.drift_ppm);
+            if (m.samples == 0)
+            {
+                m.drift_ppm = (int32_t)observed;
+                m.drift_uncertainty_ppm = TIME_DRIFT_UNKNOWN_PPM / 10;
+            }
+            else
+            {
+                m.drift_ppm = (int32_t)((m.drift_ppm * 3 + observed) / 4);
+                m.drift_uncertainty_ppm = (int32_t)(residual < TIME_DRIFT_UNKNOWN_PPM ? residual
+                                                                                    : TIME_DRIFT_UNKNOWN_PPM);
+            }
+            if (m.drift_uncertainty_ppm < TIME_DRIFT_FLOOR_PPM)
+                m.drift_uncertainty_ppm = TIME_DRIFT_FLOOR_PPM;
+            if (m.samples < 255)
+                m.samples++;
+        }
+    }
+
+    m.synced = 1;
+    m.sync_epoch_us = ntp_epoch_us - awake_now_us;  // as if taken at the start of this wake
+    m.awake_us = 0;
+    m.sleep_us = 0;
+    time_model_seal(m);
+}
@@ -0,0 +1,107 @@
+#include "timekeeper.h"
+#include <Arduino.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+#include <trmnl_log.h>
+
+RTC_DATA_ATTR static TimeModel rtc_model;
+
+// Set from the SNTP callback (lwIP task), applied in timekeeper_poll()
+static volatile bool sync_pending = false;
+static int64_t sync_epoch_us = 0;
+static int64_t sync_awake_us = 0;
+static bool sync_started = false;
+
+static int64_t system_now_us()
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void on_time_sync(struct timeval *tv)
+{
+    sync_epoch_us = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+    sync_awake_us = esp_timer_get_time();
+    sync_pending = true;
+}
+
+void timekeeper_begin()
+{
+    if (!time_model_valid(rtc_model))
+    {
+        Log_info("Time: no RTC model, waiting for NTP");
+        time_model_reset(rtc_model);
+        return;
+    }
+    if (!rtc_model.synced)
+        return;
+
+    // The system clock kept counting through deep sleep on the RTC clock
+    int64_t slept = system_now_us() - rtc_model.local_at_sleep_us - esp_timer_get_time();
+    if (slept < 0)
+    {
+        Log_error("Time: RTC clock went backwards, dropping the model");
+        time_model_reset(rtc_model);
+        return;
+    }
+    time_model_advance(rtc_model, 0, slept);
+    time_model_seal(rtc_model);
+
+    int64_t now = time_model_now_us(rtc_model, esp_timer_get_time());
+    struct timeval tv = {(time_t)(now / 1000000), (suseconds_t)(now % 1000000)};
+    settimeofday(&tv, nullptr);
+
+    time_t secs = tv.tv_sec;
+    struct tm t;
+    gmtime_r(&secs, &t);
+    Log_info("Time: %04d-%02d-%02d %02d:%02d:%02d UTC (model, ±%dms, drift %dppm)",
+             t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec,
+             (int)(time_model_error_us(rtc_model, esp_timer_get_time()) / 1000), rtc_model.drift_ppm);
+}
+
+void timekeeper_start_sync()
+{
+    if (!time_model_needs_sync(rtc_model, esp_timer_get_time()))
+        return;
+
+    Log_info("Time: estimate ±%dms, starting background NTP sync",
+             (int)(time_model_error_us(rtc_model, esp_timer_get_time()) / 1000));
+    sntp_set_time_sync_notification_cb(on_time_sync);
+    configTime(0, 0, "time.google.com", "time.cloudflare.com");  // returns at once
+    sync_started = true;
+}
+
+void timekeeper_poll()
+{
+    if (!sync_pending)
+        return;
+    sync_pending = false;
+
+    int32_t drift_before = rtc_model.drift_ppm;
+    time_model_sync(rtc_model, sync_epoch_us, sync_awake_us);
+
+    time_t secs = (time_t)(sync_epoch_us / 1000000);
+    struct tm t;
+    gmtime_r(&secs, &t);
+    Log_info("NTP synced: %04d-%02d-%02d %02d:%02d:%02d, drift %d→%dppm (±%d)",
+             t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec,
+             drift_before, rtc_model.drift_ppm, rtc_model.drift_uncertainty_ppm);
+}
+
+void timekeeper_sleep()
+{
+    timekeeper_poll();
+    if (sync_started)
+    {
+        sntp_stop();
+        sync_started = false;
+    }
+    if (!rtc_model.synced)
+        return;
+
+    time_model_advance(rtc_model, esp_timer_get_time(), 0);
+    rtc_model.local_at_sleep_us = system_now_us();
+    time_model_seal(rtc_model);
+}
@@ -0,0 +1,119 @@
+#include "wake_state.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_system.h>
+#include <config.h>
+#include <trmnl_log.h>
+
+// ---- NVS keys (namespace "data") ----
+#define PREF_MANIFEST_URL     "manifest_url"
+#define PREF_AES_KEY_HEX      "aes_key_hex"
+#define PREF_IMAGES_BASE      "images_base"
+#define PREF_WIFI_RETRY_COUNT "wifi_retry"   // progressive WiFi backoff counter
+#define PREF_API_RETRY_COUNT  "api_retry"    // progressive download backoff counter
+
+RTC_DATA_ATTR static WakeState rtc_state;
+static bool begun = false;
+
+// Copy an NVS string into the snapshot; false if it doesn't fit
+static bool snapshot_string(Preferences &prefs, const char *key, char *out, size_t cap)
+{
+    out[0] = '\0';
+    if (!prefs.isKey(key))
+        return true;  // unset: caller's default applies
+    String value = prefs.getString(key, "");
+    if (value.length() >= cap)
+        return false;
+    memcpy(out, value.c_str(), value.length() + 1);
+    return true;
+}
+
+static void load_from_nvs(Preferences &prefs)
+{
+    memset(&rtc_state, 0, sizeof(rtc_state));
+    rtc_state.wifi_retry = rtc_state.nvs_wifi_retry = prefs.getInt(PREF_WIFI_RETRY_COUNT, 1);
+    rtc_state.api_retry = rtc_state.nvs_api_retry = prefs.getInt(PREF_API_RETRY_COUNT, 1);
+    rtc_state.sleep_time = rtc_state.nvs_sleep_time = prefs.getUInt(PREFERENCES_SLEEP_TIME_KEY, 0);
+    rtc_state.config_cached =
+        snapshot_string(prefs, PREF_MANIFEST_URL, rtc_state.manifest_url, sizeof(rtc_state.manifest_url)) &&
+        snapshot_string(prefs, PREF_IMAGES_BASE, rtc_state.images_base, sizeof(rtc_state.images_base)) &&
+        snapshot_string(prefs, PREF_AES_KEY_HEX, rtc_state.aes_key_hex, sizeof(rtc_state.aes_key_hex));
+    wake_state_seal(rtc_state);
+}
+
+bool wake_state_begin(Preferences &prefs)
+{
+    begun = true;
+    if (!wake_state_valid(rtc_state))
+    {
+        Log_info("Wake state: RTC copy invalid, loading from NVS");
+        load_from_nvs(prefs);
+        return false;
+    }
+
+    // RTC memory survived something other than deep sleep: don't let a crash
+    // loop keep counters only in RAM, and pick up config reprovisioned in NVS
+    // since the snapshot was taken
+    if (esp_reset_reason() != ESP_RST_DEEPSLEEP)
+    {
+        Log_info("Wake state: reset reason %d, committing pending values and reloading NVS",
+                 (int)esp_reset_reason());
+        wake_state_commit(prefs);
+        load_from_nvs(prefs);
+    }
+    return true;
+}
+
+WakeState &wake_state()
+{
+    return rtc_state;
+}
+
+void wake_state_config(Preferences &prefs, String &manifest_url, String &images_base, String &aes_key_hex,
+                       const char *default_manifest_url, const char *default_images_base,
+                       const char *default_aes_key_hex)
+{
+    if (!rtc_state.config_cached)
+    {
+        manifest_url = prefs.getString(PREF_MANIFEST_URL, default_manifest_url);
+        images_base = prefs.getString(PREF_IMAGES_BASE, default_images_base);
+        aes_key_hex = prefs.getString(PREF_AES_KEY_HEX, default_aes_key_hex);
+        return;
+    }
+    manifest_url = rtc_state.manifest_url[0] ? rtc_state.manifest_url : default_manifest_url;
+    images_base = rtc_state.images_base[0] ? rtc_state.images_base : default_images_base;
+    aes_key_hex = rtc_state.aes_key_hex[0] ? rtc_state.aes_key_hex : default_aes_key_hex;
+}
+
+int wake_state_commit(Preferences &prefs)
+{
+    if (!begun)
+        return 0;
+
+    uint8_t dirty = wake_state_dirty(rtc_state);
+    int written = 0;
+    if ((dirty & WAKE_DIRTY_WIFI_RETRY) && prefs.putInt(PREF_WIFI_RETRY_COUNT, rtc_state.wifi_retry))
+    {
+        rtc_state.nvs_wifi_retry = rtc_state.wifi_retry;
+        written++;
+    }
+    if ((dirty & WAKE_DIRTY_API_RETRY) && prefs.putInt(PREF_API_RETRY_COUNT, rtc_state.api_retry))
+    {
+        rtc_state.nvs_api_retry = rtc_state.api_retry;
+        written++;
+    }
+    if ((dirty & WAKE_DIRTY_SLEEP_TIME) && prefs.putUInt(PREFERENCES_SLEEP_TIME_KEY, rtc_state.sleep_time))
+    {
+        rtc_state.nvs_sleep_time = rtc_state.sleep_time;
+        written++;
+    }
+    wake_state_seal(rtc_state);
+    if (written)
+        Log_info("Wake state: %d NVS key(s) written", written);
+    return written;
+}
+
+void wake_state_invalidate()
+{
+    memset(&rtc_state, 0, sizeof(rtc_state));
+}
@@ -0,0 +1,43 @@
+#include "wake_state.h"
+#include <cstring>
+
+uint32_t wake_state_checksum(const WakeState &s)
+{
+    // Bitwise CRC-32 (IEEE, reflected) — the record is < 1 KB, once per wake
+    const uint8_t *p = (const uint8_t *)&s;
+    size_t len = offsetof(WakeState, checksum);
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= p[i];
+        for (int b = 0; b < 8; b++)
+            crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+void wake_state_seal(WakeState &s)
+{
+    s.magic = WAKE_STATE_MAGIC;
+    s.version = WAKE_STATE_VERSION;
+    s.size = sizeof(WakeState);
+    s.checksum = wake_state_checksum(s);
+}
+
+bool wake_state_valid(const WakeState &s)
+{
+    return s.magic == WAKE_STATE_MAGIC && s.version == WAKE_STATE_VERSION &&
+           s.size == sizeof(WakeState) && s.checksum == wake_state_checksum(s);
+}
+
+uint8_t wake_state_dirty(const WakeState &s)
+{
+    uint8_t dirty = 0;
+    if (s.wifi_retry != s.nvs_wifi_retry)
+        dirty |= WAKE_DIRTY_WIFI_RETRY;
+    if (s.api_retry != s.nvs_api_retry)
+        dirty |= WAKE_DIRTY_API_RETRY;
+    if (s.sleep_time != s.nvs_sleep_time)
+        dirty |= WAKE_DIRTY_SLEEP_TIME;
+    return dirty;
+}
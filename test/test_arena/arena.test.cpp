@@ -0,0 +1,75 @@
+#include <unity.h>
+#include <string.h>
+
+// Include implementation directly for native testing
+#include "../../src/arena.cpp"
+
+static uint8_t block[1024 + ARENA_ALIGN];
+
+void test_alloc_is_aligned_and_bounded(void)
+{
+    Arena a;
+    arena_init(a, block + 3, 1024);  // misaligned on purpose
+    void *p1 = arena_alloc(a, 1);
+    void *p2 = arena_alloc(a, 100);
+    TEST_ASSERT_NOT_NULL(p1);
+    TEST_ASSERT_NOT_NULL(p2);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)p1 % ARENA_ALIGN);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)p2 % ARENA_ALIGN);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)p1 + ARENA_ALIGN, p2);
+
+    TEST_ASSERT_NULL(arena_alloc(a, a.capacity));
+    TEST_ASSERT_EQUAL(1, a.failed);
+    TEST_ASSERT_NOT_NULL(arena_alloc(a, a.capacity - a.used));
+    TEST_ASSERT_NULL(arena_alloc(a, 1));
+}
+
+void test_rewind_keeps_high_water(void)
+{
+    Arena a;
+    arena_init(a, block, 1024);
+    size_t mark = arena_mark(a);
+    TEST_ASSERT_NOT_NULL(arena_alloc(a, 600));
+    arena_rewind(a, mark);
+    TEST_ASSERT_EQUAL(0, a.used);
+    TEST_ASSERT_EQUAL(608, a.high_water);
+
+    // Space is reusable after rewind
+    TEST_ASSERT_NOT_NULL(arena_alloc(a, 1000));
+    TEST_ASSERT_EQUAL(1008, a.high_water);
+
+    // Rewinding forward is ignored
+    arena_rewind(a, 2000);
+    TEST_ASSERT_EQUAL(1008, a.used);
+}
+
+void test_empty_arena_refuses(void)
+{
+    Arena a;
+    arena_init(a, nullptr, 1024);
+    TEST_ASSERT_NULL(arena_alloc(a, 1));
+    TEST_ASSERT_NULL(arena_alloc(a, 0));
+    TEST_ASSERT_EQUAL(2, a.failed);
+}
+
+void test_huge_request_does_not_wrap(void)
+{
+    Arena a;
+    arena_init(a, block, 1024);
+    TEST_ASSERT_NULL(arena_alloc(a, (size_t)-1));
+    TEST_ASSERT_EQUAL(0, a.used);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_alloc_is_aligned_and_bounded);
+    RUN_TEST(test_rewind_keeps_high_water);
+    RUN_TEST(test_empty_arena_refuses);
+    RUN_TEST(test_huge_request_does_not_wrap);
+    UNITY_END();
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include <unity.h>
+#include <string.h>
+
+// Include implementation directly for native testing
+#include "../../src/bmp_stream.cpp"
+
+#define W 40   // 5 bytes per row, BMP stride 8
+#define H 3
+#define ROW_BYTES (W / 8)
+#define STRIDE 8
+
+// 1-bpp BMP, palette black/white, pixel byte = (row << 4) | col (file order)
+static size_t make_bmp(uint8_t *out, int32_t height)
+{
+    memset(out, 0, 62);
+    out[0] = 'B';
+    out[1] = 'M';
+    uint32_t size = 62 + STRIDE * H;
+    memcpy(out + 2, &size, 4);
+    uint32_t offset = 62;
+    memcpy(out + 10, &offset, 4);
+    uint32_t dib = 40;
+    memcpy(out + 14, &dib, 4);
+    int32_t width = W;
+    memcpy(out + 18, &width, 4);
+    memcpy(out + 22, &height, 4);
+    out[26] = 1;  // planes
+    out[28] = 1;  // bpp
+    out[58] = out[59] = out[60] = 0xFF;  // palette[1] = white
+    for (int r = 0; r < H; r++)
+        for (int c = 0; c < STRIDE; c++)
+            out[62 + r * STRIDE + c] = (uint8_t)((r << 4) | c);
+    return size;
+}
+
+static bool feed(BmpStream &s, const uint8_t *data, size_t len, size_t chunk)
+{
+    for (size_t off = 0; off < len; off += chunk)
+    {
+        size_t n = len - off < chunk ? len - off : chunk;
+        if (!bmp_stream_write(s, data + off, n))
+            return false;
+    }
+    return true;
+}
+
+void test_bottom_up_is_flipped(void)
+{
+    uint8_t bmp[128];
+    size_t len = make_bmp(bmp, H);
+    const size_t chunks[] = {1, 3, 16, 61, 62, 63, 1000};
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++)
+    {
+        uint8_t fb[ROW_BYTES * H];
+        memset(fb, 0xEE, sizeof(fb));
+        BmpStream s;
+        bmp_stream_begin(s, fb, W, H);
+        TEST_ASSERT_TRUE(feed(s, bmp, len, chunks[i]));
+        TEST_ASSERT_TRUE(bmp_stream_complete(s));
+        // Last file row lands on top; row padding is dropped
+        TEST_ASSERT_EQUAL_HEX8(0x20, fb[0]);
+        TEST_ASSERT_EQUAL_HEX8(0x24, fb[ROW_BYTES - 1]);
+        TEST_ASSERT_EQUAL_HEX8(0x00, fb[2 * ROW_BYTES]);
+        TEST_ASSERT_EQUAL_MEMORY(bmp, s.header, 62);
+    }
+}
+
+void test_top_down_is_copied(void)
+{
+    uint8_t bmp[128];
+    size_t len = make_bmp(bmp, -H);
+    uint8_t fb[ROW_BYTES * H];
+    BmpStream s;
+    bmp_stream_begin(s, fb, W, H);
+    TEST_ASSERT_TRUE(feed(s, bmp, len, 5));
+    TEST_ASSERT_TRUE(bmp_stream_complete(s));
+    TEST_ASSERT_EQUAL_HEX8(0x00, fb[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x21, fb[2 * ROW_BYTES + 1]);
+}
+
+void test_incomplete_is_not_complete(void)
+{
+    uint8_t bmp[128];
+    size_t len = make_bmp(bmp, H);
+    uint8_t fb[ROW_BYTES * H];
+    BmpStream s;
+    bmp_stream_begin(s, fb, W, H);
+    TEST_ASSERT_TRUE(feed(s, bmp, len - 1, 4));
+    TEST_ASSERT_FALSE(bmp_stream_complete(s));
+}
+
+void test_rejects_wrong_geometry_or_depth(void)
+{
+    uint8_t bmp[128];
+    uint8_t fb[ROW_BYTES * H];
+    BmpStream s;
+
+    size_t len = make_bmp(bmp, H);
+    bmp_stream_begin(s, fb, W + 8, H);
+    TEST_ASSERT_FALSE(feed(s, bmp, len, 7));
+
+    bmp[28] = 8;
+    bmp_stream_begin(s, fb, W, H);
+    TEST_ASSERT_FALSE(feed(s, bmp, len, 7));
+
+    len = make_bmp(bmp, H);
+    bmp[0] = 'X';
+    bmp_stream_begin(s, fb, W, H);
+    TEST_ASSERT_FALSE(feed(s, bmp, len, 7));
+    TEST_ASSERT_FALSE(bmp_stream_complete(s));
+}
+
+void test_rejects_data_past_file_size(void)
+{
+    uint8_t bmp[160];
+    size_t len = make_bmp(bmp, H);
+    memset(bmp + len, 0, 8);
+    uint8_t fb[ROW_BYTES * H];
+    BmpStream s;
+    bmp_stream_begin(s, fb, W, H);
+    TEST_ASSERT_FALSE(feed(s, bmp, len + 8, 16));
+}
+
+void test_trailing_bytes_count_toward_file_size(void)
+{
+    // Byte-sized chunks must not slip trailing data past the limit one at a time
+    uint8_t bmp[160];
+    size_t len = make_bmp(bmp, H);
+    uint32_t declared = len + 4;
+    memcpy(bmp + 2, &declared, 4);
+    memset(bmp + len, 0, 8);
+    uint8_t fb[ROW_BYTES * H];
+    BmpStream s;
+
+    bmp_stream_begin(s, fb, W, H);
+    TEST_ASSERT_TRUE(feed(s, bmp, declared, 1));
+    TEST_ASSERT_TRUE(bmp_stream_complete(s));
+
+    bmp_stream_begin(s, fb, W, H);
+    TEST_ASSERT_FALSE(feed(s, bmp, declared + 1, 1));
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bottom_up_is_flipped);
+    RUN_TEST(test_top_down_is_copied);
+    RUN_TEST(test_incomplete_is_not_complete);
+    RUN_TEST(test_rejects_wrong_geometry_or_depth);
+    RUN_TEST(test_rejects_data_past_file_size);
+    RUN_TEST(test_trailing_bytes_count_toward_file_size);
+    UNITY_END();
+    return 0;
+}
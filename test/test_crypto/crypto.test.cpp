@@ -5,36 +5,6 @@
 // Include crypto implementation directly for native testing
 #include "../../src/crypto.cpp"
 
-// Helper: encrypt with AES-256-CBC + PKCS7 for test purposes
-static bool aes256_cbc_encrypt(const uint8_t *key, const uint8_t *iv,
-                                const uint8_t *input, size_t input_len,
-                                uint8_t *output, size_t *output_len)
-{
-    // PKCS7 pad
-    uint8_t pad_value = 16 - (input_len % 16);
-    size_t padded_len = input_len + pad_value;
-
-    uint8_t *padded = new uint8_t[padded_len];
-    memcpy(padded, input, input_len);
-    memset(padded + input_len, pad_value, pad_value);
-
-    // Prepend IV
-    memcpy(output, iv, 16);
-
-    mbedtls_aes_context ctx;
-    mbedtls_aes_init(&ctx);
-    mbedtls_aes_setkey_enc(&ctx, key, 256);
-
-    uint8_t iv_copy[16];
-    memcpy(iv_copy, iv, 16);
-    int ret = mbedtls_aes_crypt_cbc(&ctx, MBEDTLS_AES_ENCRYPT, padded_len, iv_copy, padded, output + 16);
-    mbedtls_aes_free(&ctx);
-    delete[] padded;
-
-    *output_len = 16 + padded_len;
-    return ret == 0;
-}
-
 // ---- Tests ----
 
 void test_hex_to_bytes_valid(void)
@@ -112,6 +82,34 @@ void test_decrypt_exact_block_size(void)
     TEST_ASSERT_EQUAL_MEMORY(plaintext, decrypted, 16);
 }
 
+void test_encrypt_pads_aligned_input(void)
+{
+    uint8_t key[32], iv[16], plain[32];
+    memset(key, 0x5A, sizeof(key));
+    memset(iv, 0x01, sizeof(iv));
+    memset(plain, 0x7E, sizeof(plain));
+
+    // Block-aligned input still gets a whole padding block
+    uint8_t encrypted[64];
+    size_t enc_len = 0;
+    TEST_ASSERT_TRUE(aes256_cbc_encrypt(key, iv, plain, sizeof(plain), encrypted, &enc_len));
+    TEST_ASSERT_EQUAL(aes256_cbc_encrypted_size(sizeof(plain)), enc_len);
+    TEST_ASSERT_EQUAL(64, enc_len);
+    TEST_ASSERT_EQUAL_MEMORY(iv, encrypted, 16);
+
+    uint8_t decrypted[48];
+    size_t dec_len = 0;
+    TEST_ASSERT_TRUE(aes256_cbc_decrypt(key, encrypted, enc_len, decrypted, &dec_len));
+    TEST_ASSERT_EQUAL(sizeof(plain), dec_len);
+    TEST_ASSERT_EQUAL_MEMORY(plain, decrypted, dec_len);
+
+    // Empty input is one padding block
+    TEST_ASSERT_TRUE(aes256_cbc_encrypt(key, iv, nullptr, 0, encrypted, &enc_len));
+    TEST_ASSERT_EQUAL(32, enc_len);
+    TEST_ASSERT_TRUE(aes256_cbc_decrypt(key, encrypted, enc_len, decrypted, &dec_len));
+    TEST_ASSERT_EQUAL(0, dec_len);
+}
+
 void test_decrypt_too_short(void)
 {
     uint8_t key[32] = {0};
@@ -183,6 +181,172 @@ void test_decrypt_large_binary_data(void)
     delete[] decrypted;
 }
 
+// ---- Streaming decrypt ----
+
+struct CollectSink
+{
+    uint8_t data[2048];
+    size_t len;
+};
+
+static bool collect(const uint8_t *data, size_t len, void *ctx)
+{
+    CollectSink *c = (CollectSink *)ctx;
+    if (c->len + len > sizeof(c->data))
+        return false;
+    memcpy(c->data + c->len, data, len);
+    c->len += len;
+    return true;
+}
+
+static bool refuse(const uint8_t *, size_t, void *)
+{
+    return false;
+}
+
+void test_stream_matches_buffered_for_any_chunking(void)
+{
+    uint8_t key[32];
+    memset(key, 0x5A, 32);
+    uint8_t iv[16];
+    memset(iv, 0x11, 16);
+
+    const size_t data_size = 1000;  // not a block multiple
+    uint8_t plaintext[data_size];
+    for (size_t i = 0; i < data_size; i++)
+        plaintext[i] = (uint8_t)(i * 7);
+
+    uint8_t encrypted[data_size + 48];
+    size_t encrypted_len = 0;
+    TEST_ASSERT_TRUE(aes256_cbc_encrypt(key, iv, plaintext, data_size, encrypted, &encrypted_len));
+
+    const size_t chunk_sizes[] = {1, 7, 16, 17, 100, encrypted_len};
+    for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++)
+    {
+        static CollectSink sink;
+        sink.len = 0;
+        Aes256CbcStream s;
+        TEST_ASSERT_TRUE(aes256_cbc_stream_begin(s, key));
+        for (size_t off = 0; off < encrypted_len; off += chunk_sizes[c])
+        {
+            size_t n = encrypted_len - off < chunk_sizes[c] ? encrypted_len - off : chunk_sizes[c];
+            TEST_ASSERT_TRUE(aes256_cbc_stream_update(s, encrypted + off, n, collect, &sink));
+        }
+        TEST_ASSERT_TRUE(aes256_cbc_stream_finish(s, collect, &sink));
+        TEST_ASSERT_EQUAL(data_size, sink.len);
+        TEST_ASSERT_EQUAL_MEMORY(plaintext, sink.data, data_size);
+    }
+}
+
+void test_stream_rejects_truncated_input(void)
+{
+    uint8_t key[32];
+    memset(key, 0x5A, 32);
+    uint8_t iv[16] = {0};
+    const uint8_t plaintext[20] = {1, 2, 3};
+    uint8_t encrypted[64];
+    size_t encrypted_len = 0;
+    TEST_ASSERT_TRUE(aes256_cbc_encrypt(key, iv, plaintext, sizeof(plaintext), encrypted, &encrypted_len));
+
+    static CollectSink sink;
+    sink.len = 0;
+    Aes256CbcStream s;
+    TEST_ASSERT_TRUE(aes256_cbc_stream_begin(s, key));
+    TEST_ASSERT_TRUE(aes256_cbc_stream_update(s, encrypted, encrypted_len - 5, collect, &sink));
+    TEST_ASSERT_FALSE(aes256_cbc_stream_finish(s, collect, &sink));
+
+    // IV only
+    TEST_ASSERT_TRUE(aes256_cbc_stream_begin(s, key));
+    TEST_ASSERT_TRUE(aes256_cbc_stream_update(s, encrypted, AES_IV_SIZE, collect, &sink));
+    TEST_ASSERT_FALSE(aes256_cbc_stream_finish(s, collect, &sink));
+}
+
+void test_stream_sink_abort(void)
+{
+    uint8_t key[32];
+    memset(key, 0x5A, 32);
+    uint8_t iv[16] = {0};
+    uint8_t plaintext[64] = {0};
+    uint8_t encrypted[128];
+    size_t encrypted_len = 0;
+    TEST_ASSERT_TRUE(aes256_cbc_encrypt(key, iv, plaintext, sizeof(plaintext), encrypted, &encrypted_len));
+
+    Aes256CbcStream s;
+    TEST_ASSERT_TRUE(aes256_cbc_stream_begin(s, key));
+    TEST_ASSERT_FALSE(aes256_cbc_stream_update(s, encrypted, encrypted_len, refuse, nullptr));
+    TEST_ASSERT_FALSE(aes256_cbc_stream_update(s, encrypted, 16, refuse, nullptr));
+    TEST_ASSERT_FALSE(aes256_cbc_stream_finish(s, refuse, nullptr));
+}
+
+// ---- Random-access reader ----
+
+struct MemoryFile
+{
+    const uint8_t *data;
+    size_t len;
+    int fetches;
+};
+
+static bool fetch_memory(size_t offset, uint8_t *buf, size_t len, void *ctx)
+{
+    MemoryFile *f = (MemoryFile *)ctx;
+    if (offset + len > f->len)
+        return false;
+    memcpy(buf, f->data + offset, len);
+    f->fetches++;
+    return true;
+}
+
+void test_reader_random_access(void)
+{
+    uint8_t key[32];
+    memset(key, 0x24, 32);
+    uint8_t iv[16];
+    memset(iv, 0x99, 16);
+
+    const size_t data_size = 1500;
+    static uint8_t plaintext[data_size];
+    for (size_t i = 0; i < data_size; i++)
+        plaintext[i] = (uint8_t)(i * 13 + 5);
+    static uint8_t encrypted[data_size + 48];
+    size_t encrypted_len = 0;
+    TEST_ASSERT_TRUE(aes256_cbc_encrypt(key, iv, plaintext, data_size, encrypted, &encrypted_len));
+
+    MemoryFile file = {encrypted, encrypted_len, 0};
+    static Aes256CbcReader r;
+    TEST_ASSERT_TRUE(aes256_cbc_reader_open(r, key, encrypted_len, fetch_memory, &file));
+    TEST_ASSERT_EQUAL(data_size, r.plain_len);
+
+    // Spans a window boundary, reads backwards, and stops at the end
+    uint8_t out[700];
+    TEST_ASSERT_EQUAL(700, aes256_cbc_reader_read(r, 300, out, 700));
+    TEST_ASSERT_EQUAL_MEMORY(plaintext + 300, out, 700);
+    TEST_ASSERT_EQUAL(1, aes256_cbc_reader_read(r, 0, out, 1));
+    TEST_ASSERT_EQUAL_HEX8(plaintext[0], out[0]);
+    TEST_ASSERT_EQUAL(100, aes256_cbc_reader_read(r, data_size - 100, out, 700));
+    TEST_ASSERT_EQUAL_MEMORY(plaintext + data_size - 100, out, 100);
+    TEST_ASSERT_EQUAL(0, aes256_cbc_reader_read(r, data_size, out, 10));
+
+    // Sequential small reads reuse the decrypted window
+    int before = file.fetches;
+    for (size_t pos = 0; pos < 256; pos += 16)
+        TEST_ASSERT_EQUAL(16, aes256_cbc_reader_read(r, pos, out, 16));
+    TEST_ASSERT_EQUAL(before + 1, file.fetches);
+    aes256_cbc_reader_close(r);
+}
+
+void test_reader_rejects_bad_input(void)
+{
+    uint8_t key[32] = {0};
+    static uint8_t garbage[64];
+    memset(garbage, 0x33, sizeof(garbage));
+    MemoryFile file = {garbage, sizeof(garbage), 0};
+    static Aes256CbcReader r;
+    TEST_ASSERT_FALSE(aes256_cbc_reader_open(r, key, 40, fetch_memory, &file));   // not block aligned
+    TEST_ASSERT_FALSE(aes256_cbc_reader_open(r, key, 16, fetch_memory, &file));   // IV only
+    TEST_ASSERT_FALSE(aes256_cbc_reader_open(r, key, 128, fetch_memory, &file));  // past end of file
+}
+
 void setUp(void) {}
 void tearDown(void) {}
 
@@ -194,9 +358,15 @@ int main(int argc, char **argv)
     RUN_TEST(test_hex_to_bytes_invalid);
     RUN_TEST(test_decrypt_roundtrip);
     RUN_TEST(test_decrypt_exact_block_size);
+    RUN_TEST(test_encrypt_pads_aligned_input);
     RUN_TEST(test_decrypt_too_short);
     RUN_TEST(test_decrypt_bad_padding);
     RUN_TEST(test_decrypt_large_binary_data);
+    RUN_TEST(test_stream_matches_buffered_for_any_chunking);
+    RUN_TEST(test_stream_rejects_truncated_input);
+    RUN_TEST(test_stream_sink_abort);
+    RUN_TEST(test_reader_random_access);
+    RUN_TEST(test_reader_rejects_bad_input);
     UNITY_END();
     return 0;
 }
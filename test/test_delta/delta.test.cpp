@@ -0,0 +1,316 @@
+#include <unity.h>
+#include <string.h>
+
+// Include delta implementation directly for native testing
+#include "../../src/delta.cpp"
+#include "../../src/refresh_policy.cpp"
+
+// Produced by tools/make_delta.py: base = bytes 0..63, target = base with
+// [3] = 0xAA, [40..43] = "WXYZ", plus two appended bytes 01 02.
+static const uint8_t tool_delta[] = {
+    0x54, 0x44, 0x4c, 0x54, 0x01, 0x00, 0x00, 0x00, 0xfd, 0xea, 0xb9, 0xac, 0xf3, 0x71,
+    0x03, 0x62, 0xba, 0x3b, 0x0f, 0x7a, 0xb3, 0x7f, 0x34, 0xb3, 0x42, 0x00, 0x00, 0x00,
+    0x03, 0x01, 0xa9, 0x24, 0x04, 0x7f, 0x71, 0x73, 0x71, 0x14, 0x02, 0x01, 0x02};
+
+// make_delta.py on a 16x2 1-bpp BMP (all white) with pixels 8..15 of the top
+// row set black — carries a one-entry changed-region table.
+static const uint8_t bmp_delta[] = {
+    0x54, 0x44, 0x4c, 0x54, 0x01, 0x01, 0x00, 0x00, 0x2b, 0x12, 0xea, 0x5e, 0x94, 0x51,
+    0xa9, 0xbc, 0xad, 0x03, 0xc2, 0xb3, 0x45, 0x5d, 0xb6, 0xfe, 0x46, 0x00, 0x00, 0x00,
+    0x01, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x43, 0x01, 0xff};
+
+static void fill_base(uint8_t *frame)
+{
+    for (int i = 0; i < 64; i++)
+        frame[i] = (uint8_t)i;
+}
+
+// Build a header-only delta with the given target size
+static size_t make_header(uint8_t *out, uint32_t target_size)
+{
+    memset(out, 0, DELTA_HEADER_SIZE);
+    memcpy(out, DELTA_MAGIC, 4);
+    out[4] = DELTA_VERSION;
+    out[24] = target_size & 0xFF;
+    out[25] = (target_size >> 8) & 0xFF;
+    out[26] = (target_size >> 16) & 0xFF;
+    out[27] = (target_size >> 24) & 0xFF;
+    return DELTA_HEADER_SIZE;
+}
+
+// ---- Tests ----
+
+void test_parse_header(void)
+{
+    DeltaHeader header;
+    TEST_ASSERT_TRUE(delta_parse_header(tool_delta, sizeof(tool_delta), header));
+    TEST_ASSERT_EQUAL(66, header.target_size);
+    TEST_ASSERT_EQUAL_HEX8(0xfd, header.base_hash[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xba, header.target_hash[0]);
+}
+
+void test_parse_header_rects(void)
+{
+    DeltaHeader header;
+    TEST_ASSERT_TRUE(delta_parse_header(tool_delta, sizeof(tool_delta), header));
+    TEST_ASSERT_FALSE(header.has_rects);
+    TEST_ASSERT_EQUAL(DELTA_HEADER_SIZE, header.ops_offset);
+
+    TEST_ASSERT_TRUE(delta_parse_header(bmp_delta, sizeof(bmp_delta), header));
+    TEST_ASSERT_TRUE(header.has_rects);
+    TEST_ASSERT_EQUAL(1, header.rect_count);
+    TEST_ASSERT_EQUAL(8, header.rects[0].x);
+    TEST_ASSERT_EQUAL(0, header.rects[0].y);
+    TEST_ASSERT_EQUAL(8, header.rects[0].w);
+    TEST_ASSERT_EQUAL(1, header.rects[0].h);
+    TEST_ASSERT_EQUAL(8, delta_rect_area(header));
+    TEST_ASSERT_EQUAL(DELTA_HEADER_SIZE + 1 + 8, header.ops_offset);
+
+    // Rect table cut short
+    TEST_ASSERT_FALSE(delta_parse_header(bmp_delta, DELTA_HEADER_SIZE + 5, header));
+}
+
+void test_apply_with_rects(void)
+{
+    uint8_t frame[70];
+    memset(frame, 0xff, sizeof(frame));
+    size_t len = sizeof(frame);
+    TEST_ASSERT_TRUE(delta_apply(bmp_delta, sizeof(bmp_delta), frame, sizeof(frame), &len));
+    TEST_ASSERT_EQUAL(70, len);
+    TEST_ASSERT_EQUAL_HEX8(0x00, frame[67]);
+    TEST_ASSERT_EQUAL_HEX8(0xff, frame[66]);
+}
+
+void test_parse_header_rejects_bad_magic(void)
+{
+    uint8_t delta[sizeof(tool_delta)];
+    memcpy(delta, tool_delta, sizeof(delta));
+    delta[0] = 'X';
+    DeltaHeader header;
+    TEST_ASSERT_FALSE(delta_parse_header(delta, sizeof(delta), header));
+    TEST_ASSERT_FALSE(delta_parse_header(tool_delta, DELTA_HEADER_SIZE - 1, header));
+}
+
+void test_apply_tool_delta(void)
+{
+    uint8_t frame[80];
+    fill_base(frame);
+    size_t len = 64;
+
+    uint8_t base_hash[FRAME_HASH_SIZE];
+    frame_hash(frame, len, base_hash);
+    TEST_ASSERT_EQUAL_MEMORY(tool_delta + 8, base_hash, FRAME_HASH_SIZE);
+
+    TEST_ASSERT_TRUE(delta_apply(tool_delta, sizeof(tool_delta), frame, sizeof(frame), &len));
+    TEST_ASSERT_EQUAL(66, len);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, frame[3]);
+    TEST_ASSERT_EQUAL_MEMORY("WXYZ", frame + 40, 4);
+    TEST_ASSERT_EQUAL_HEX8(0x01, frame[64]);
+    TEST_ASSERT_EQUAL_HEX8(0x02, frame[65]);
+
+    uint8_t result_hash[FRAME_HASH_SIZE];
+    frame_hash(frame, len, result_hash);
+    TEST_ASSERT_EQUAL_MEMORY(tool_delta + 16, result_hash, FRAME_HASH_SIZE);
+}
+
+void test_apply_needs_capacity(void)
+{
+    uint8_t frame[64];
+    fill_base(frame);
+    size_t len = 64;
+    TEST_ASSERT_FALSE(delta_apply(tool_delta, sizeof(tool_delta), frame, sizeof(frame), &len));
+}
+
+void test_apply_truncates(void)
+{
+    uint8_t delta[DELTA_HEADER_SIZE];
+    make_header(delta, 10);
+
+    uint8_t frame[64];
+    fill_base(frame);
+    size_t len = 64;
+    TEST_ASSERT_TRUE(delta_apply(delta, sizeof(delta), frame, sizeof(frame), &len));
+    TEST_ASSERT_EQUAL(10, len);
+    TEST_ASSERT_EQUAL_HEX8(9, frame[9]);
+}
+
+void test_apply_rejects_op_past_target(void)
+{
+    uint8_t delta[DELTA_HEADER_SIZE + 4];
+    size_t n = make_header(delta, 16);
+    delta[n++] = 14;  // skip
+    delta[n++] = 3;   // run — would write bytes 14..16
+    delta[n++] = 0xFF;
+    delta[n++] = 0xFF;
+
+    uint8_t frame[64] = {0};
+    size_t len = 16;
+    TEST_ASSERT_FALSE(delta_apply(delta, n, frame, sizeof(frame), &len));
+}
+
+void test_apply_rejects_truncated_ops(void)
+{
+    uint8_t delta[DELTA_HEADER_SIZE + 3];
+    size_t n = make_header(delta, 16);
+    delta[n++] = 0;
+    delta[n++] = 4;  // run of 4 but only 1 literal byte follows
+    delta[n++] = 0x55;
+
+    uint8_t frame[64] = {0};
+    size_t len = 16;
+    TEST_ASSERT_FALSE(delta_apply(delta, n, frame, sizeof(frame), &len));
+
+    // Unterminated varint
+    n = make_header(delta, 16);
+    delta[n++] = 0x80;
+    TEST_ASSERT_FALSE(delta_apply(delta, n, frame, sizeof(frame), &len));
+}
+
+void test_frame_hash_hex(void)
+{
+    // SHA-256("abc") = ba7816bf8f01cfea...
+    uint8_t hash[FRAME_HASH_SIZE];
+    frame_hash((const uint8_t *)"abc", 3, hash);
+    char hex[FRAME_HASH_HEX_SIZE];
+    frame_hash_to_hex(hash, hex);
+    TEST_ASSERT_EQUAL_STRING("ba7816bf8f01cfea", hex);
+}
+
+// ---- Refresh policy ----
+
+static RefreshState shown_base(const DeltaHeader &h)
+{
+    RefreshState state = {};
+    state.displayed_valid = 1;
+    memcpy(state.displayed_hash, h.base_hash, FRAME_HASH_SIZE);
+    return state;
+}
+
+static RefreshRequest partial_request(const DeltaHeader &h)
+{
+    RefreshRequest req = {};
+    req.partial_capable = true;
+    req.target_hash = h.target_hash;
+    req.delta = &h;
+    req.panel_area = 800 * 480;
+    return req;
+}
+
+void test_policy_partial_on_matching_base(void)
+{
+    DeltaHeader h;
+    TEST_ASSERT_TRUE(delta_parse_header(bmp_delta, sizeof(bmp_delta), h));
+    RefreshState state = shown_base(h);
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_PARTIAL, refresh_policy_decide(state, partial_request(h)));
+
+    refresh_policy_record(state, REFRESH_ACTION_PARTIAL, h.target_hash);
+    TEST_ASSERT_EQUAL_UINT8(1, state.partials_since_full);
+    TEST_ASSERT_EQUAL_MEMORY(h.target_hash, state.displayed_hash, FRAME_HASH_SIZE);
+}
+
+void test_policy_full_when_forced_or_unknown(void)
+{
+    DeltaHeader h;
+    TEST_ASSERT_TRUE(delta_parse_header(bmp_delta, sizeof(bmp_delta), h));
+    RefreshState state = shown_base(h);
+    RefreshRequest req = partial_request(h);
+
+    req.force_full = true;
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_FULL, refresh_policy_decide(state, req));
+
+    req.force_full = false;
+    state.displayed_valid = 0;
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_FULL, refresh_policy_decide(state, req));
+
+    // Panel shows something other than the delta's base
+    state = shown_base(h);
+    state.displayed_hash[0] ^= 1;
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_FULL, refresh_policy_decide(state, req));
+
+    // Board or format can't do it
+    state = shown_base(h);
+    req.partial_capable = false;
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_FULL, refresh_policy_decide(state, req));
+}
+
+void test_policy_full_after_max_partials(void)
+{
+    DeltaHeader h;
+    TEST_ASSERT_TRUE(delta_parse_header(bmp_delta, sizeof(bmp_delta), h));
+    RefreshState state = shown_base(h);
+    state.partials_since_full = REFRESH_MAX_PARTIALS;
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_FULL, refresh_policy_decide(state, partial_request(h)));
+
+    refresh_policy_record(state, REFRESH_ACTION_FULL, h.target_hash);
+    TEST_ASSERT_EQUAL_UINT8(0, state.partials_since_full);
+}
+
+void test_policy_full_when_area_too_large(void)
+{
+    DeltaHeader h;
+    TEST_ASSERT_TRUE(delta_parse_header(bmp_delta, sizeof(bmp_delta), h));
+    RefreshState state = shown_base(h);
+    RefreshRequest req = partial_request(h);
+    req.panel_area = 16;  // 8 changed pixels of 16 is over the limit
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_FULL, refresh_policy_decide(state, req));
+}
+
+void test_policy_skip_when_already_shown(void)
+{
+    DeltaHeader h;
+    TEST_ASSERT_TRUE(delta_parse_header(bmp_delta, sizeof(bmp_delta), h));
+    RefreshState state = {};
+    refresh_policy_record(state, REFRESH_ACTION_FULL, h.target_hash);
+
+    RefreshRequest req = partial_request(h);
+    req.delta = nullptr;
+    TEST_ASSERT_EQUAL(REFRESH_ACTION_SKIP, refresh_policy_decide(state, req));
+
+    refresh_policy_record(state, REFRESH_ACTION_SKIP, h.target_hash);
+    TEST_ASSERT_EQUAL_UINT8(0, state.partials_since_full);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_panel_mode_like_display_show_image(void)
+{
+    RefreshState state = {};
+    TEST_ASSERT_EQUAL(PANEL_REFRESH_PARTIAL, refresh_policy_panel_mode(state, false, 900));
+    TEST_ASSERT_EQUAL(PANEL_REFRESH_FULL, refresh_policy_panel_mode(state, true, 900));
+    TEST_ASSERT_EQUAL(PANEL_REFRESH_FAST, refresh_policy_panel_mode(state, false, REFRESH_FAST_MIN_SLEEP_SECONDS));
+
+    // Partials count towards the same ghosting limit as delta refreshes
+    for (int i = 0; i < REFRESH_MAX_PARTIALS; i++)
+    {
+        TEST_ASSERT_EQUAL(PANEL_REFRESH_PARTIAL, refresh_policy_panel_mode(state, false, 900));
+        refresh_policy_record(state, REFRESH_ACTION_PARTIAL, nullptr);
+    }
+    TEST_ASSERT_EQUAL(PANEL_REFRESH_FULL, refresh_policy_panel_mode(state, false, 900));
+    TEST_ASSERT_EQUAL(PANEL_REFRESH_FULL, refresh_policy_panel_mode(state, false, 3600));
+    refresh_policy_record(state, REFRESH_ACTION_FULL, nullptr);
+    TEST_ASSERT_EQUAL(PANEL_REFRESH_PARTIAL, refresh_policy_panel_mode(state, false, 900));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_header);
+    RUN_TEST(test_parse_header_rects);
+    RUN_TEST(test_apply_with_rects);
+    RUN_TEST(test_parse_header_rejects_bad_magic);
+    RUN_TEST(test_apply_tool_delta);
+    RUN_TEST(test_apply_needs_capacity);
+    RUN_TEST(test_apply_truncates);
+    RUN_TEST(test_apply_rejects_op_past_target);
+    RUN_TEST(test_apply_rejects_truncated_ops);
+    RUN_TEST(test_frame_hash_hex);
+    RUN_TEST(test_policy_partial_on_matching_base);
+    RUN_TEST(test_policy_full_when_forced_or_unknown);
+    RUN_TEST(test_policy_full_after_max_partials);
+    RUN_TEST(test_policy_full_when_area_too_large);
+    RUN_TEST(test_policy_skip_when_already_shown);
+    RUN_TEST(test_panel_mode_like_display_show_image);
+    UNITY_END();
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <unity.h>
+#include <string.h>
+
+// bb_epaper's own G5 decoder, the one bbep.loadG5Image() runs on the device.
+// Built from the bb_epaper sources that env:native-g5 pulls in.
+#include "Group5.h"
+#include "g5dec.inl"
+
+#include "../../src/image_format.cpp"
+#include "g5_fixture.h"
+
+// The fixture is tools/g5_pack.py output for this pattern; keep it identical
+// to pattern_black() in make_fixture.py.
+static bool pattern_black(int x, int y)
+{
+    if (y < 60)
+        return ((x + y) / 8) % 2 == 1;
+    if (y < 120)
+        return x >= 100 && x < 700 && y % 20 < 12;
+    if (y < 200)
+    {
+        if (x < 300 || x >= 420)
+            return false;
+        uint32_t h = (uint32_t)(x * 7 + y * 13) * 2654435761u;
+        return ((h >> 13) & 1) == 1;
+    }
+    if (y < 300)
+        return (x - 400) * (x - 400) + (y - 250) * (y - 250) < 45 * 45;
+    if (y < 400)
+        return (x / (1 + y % 37)) % 2 == 1;
+    return x % 97 < y % 13;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_fixture_header(void)
+{
+    TEST_ASSERT_TRUE(g5_header_valid(g5_fixture, sizeof(g5_fixture)));
+    uint16_t payload = g5_fixture[6] | (g5_fixture[7] << 8);
+    TEST_ASSERT_EQUAL(sizeof(g5_fixture) - G5_HEADER_SIZE, payload);
+}
+
+void test_bb_epaper_decodes_packer_output(void)
+{
+    static uint8_t line[(G5_FIXTURE_WIDTH + 7) / 8];
+    G5DECIMAGE g5;
+    int rc = g5_decode_init(&g5, G5_FIXTURE_WIDTH, G5_FIXTURE_HEIGHT,
+                            (uint8_t *)g5_fixture + G5_HEADER_SIZE,
+                            sizeof(g5_fixture) - G5_HEADER_SIZE);
+    TEST_ASSERT_EQUAL(G5_SUCCESS, rc);
+
+    for (int y = 0; y < G5_FIXTURE_HEIGHT; y++)
+    {
+        memset(line, 0, sizeof(line));
+        rc = g5_decode_line(&g5, line);
+        if (rc != G5_SUCCESS && rc != G5_DECODE_COMPLETE)
+        {
+            char msg[48];
+            snprintf(msg, sizeof(msg), "decode error %d at row %d", rc, y);
+            TEST_FAIL_MESSAGE(msg);
+        }
+        for (int x = 0; x < G5_FIXTURE_WIDTH; x++)
+        {
+            // A set bit is a black pixel, MSB first
+            bool black = (line[x >> 3] & (0x80 >> (x & 7))) != 0;
+            if (black != pattern_black(x, y))
+            {
+                char msg[48];
+                snprintf(msg, sizeof(msg), "pixel mismatch at (%d, %d)", x, y);
+                TEST_FAIL_MESSAGE(msg);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_fixture_header);
+    RUN_TEST(test_bb_epaper_decodes_packer_output);
+    return UNITY_END();
+}
@@ -0,0 +1,781 @@
+// Generated by make_fixture.py from tools/g5_pack.py — do not edit
+#ifndef G5_FIXTURE_H
+#define G5_FIXTURE_H
+
+#define G5_FIXTURE_WIDTH 800
+#define G5_FIXTURE_HEIGHT 480
+
+static const uint8_t g5_fixture[] = {
+    0xbf, 0xbb, 0x20, 0x03, 0xe0, 0x01, 0x11, 0x30, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41,
+    0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04,
+    0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82,
+    0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x21, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0xa9, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x25, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x2a, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x52, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x4a, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x54, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0xa4, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x96, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x5a, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x69, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x25, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x96, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x5a,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x69, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x25, 0x14, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x95, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0xa9, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x25, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x2a, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x52, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x4a, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x54, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x96, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x5a, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x69, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x25, 0xa4,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x96, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x5a, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x69, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x25, 0x14, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x95, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0xa9, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x25, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x2a, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x52, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x4a, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x54, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x96, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x5a, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x69, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x25, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x96,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x5a, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x69, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x25, 0x14, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x95, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0xa9, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x25, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x2a, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x52, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x4a, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x54, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0xa4, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x96, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x5a, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x69,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x25, 0x11, 0x11, 0x11, 0x27, 0xe5, 0x81, 0x11, 0x11, 0x10, 0x7f, 0xff,
+    0xff, 0xff, 0xf1, 0xff, 0x31, 0x93, 0x2c, 0x7f, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0x63, 0x26, 0x58,
+    0xff, 0xff, 0xff, 0xff, 0xc7, 0xfc, 0xd2, 0xd0, 0x88, 0x40, 0x90, 0x81, 0x21, 0x04, 0x41, 0x08,
+    0x84, 0x09, 0x08, 0x12, 0x10, 0x44, 0x10, 0x88, 0x21, 0x10, 0x81, 0x21, 0x02, 0x42, 0x08, 0x82,
+    0x11, 0x08, 0x12, 0x10, 0x24, 0x20, 0x88, 0x21, 0x10, 0x42, 0x21, 0x02, 0x42, 0x08, 0x82, 0x11,
+    0x04, 0x22, 0x10, 0x24, 0x20, 0x48, 0x41, 0x10, 0x42, 0x20, 0x84, 0x42, 0x04, 0x84, 0x11, 0x04,
+    0x22, 0x08, 0x44, 0x20, 0x48, 0x40, 0x90, 0x82, 0x20, 0x84, 0x42, 0x06, 0x82, 0x04, 0xd8, 0x4c,
+    0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09,
+    0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8,
+    0x27, 0x7b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30,
+    0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26,
+    0xc1, 0x3b, 0x60, 0x9d, 0xb2, 0x08, 0x37, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36,
+    0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09,
+    0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x76, 0x09, 0xb0, 0x4e, 0xd8, 0x26,
+    0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61,
+    0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb8, 0x41,
+    0x30, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8,
+    0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60,
+    0x9b, 0x09, 0x82, 0x6c, 0x13, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x4c, 0x13, 0x60,
+    0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e,
+    0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x21, 0xb6, 0xc2, 0x60, 0x9b, 0x04, 0xed,
+    0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1,
+    0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0xa0, 0x81,
+    0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d,
+    0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8,
+    0x27, 0x6c, 0x82, 0x17, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8,
+    0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13,
+    0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x64, 0x10, 0x6c, 0x13, 0x60, 0x9d, 0xb0, 0x4d, 0x84,
+    0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60,
+    0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x76, 0x09, 0xb0,
+    0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c,
+    0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09,
+    0xb0, 0x4f, 0x08, 0x26, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26,
+    0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b,
+    0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x99, 0x06, 0xbe, 0x5b, 0x09, 0x82, 0x6c, 0x26, 0x09,
+    0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8,
+    0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x63, 0x6e,
+    0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c,
+    0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09,
+    0xdb, 0x20, 0x85, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27,
+    0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6,
+    0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x64, 0x10, 0xa1, 0x02, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98,
+    0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13,
+    0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x82, 0x0d, 0x82,
+    0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36,
+    0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09,
+    0x82, 0x6c, 0x13, 0x8d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09,
+    0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8,
+    0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd9, 0x06, 0xbe, 0x84, 0x15, 0xb0, 0x4d, 0x84, 0xc1, 0x36,
+    0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x13, 0x04, 0xd8,
+    0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x4c, 0x13, 0x64,
+    0x1a, 0xf9, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60,
+    0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d,
+    0x82, 0x76, 0xc1, 0x3b, 0x60, 0x98, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4d, 0x84,
+    0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60,
+    0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd9, 0x04, 0x2b, 0x60, 0x9d, 0xb0, 0x4d,
+    0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2,
+    0x60, 0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x64, 0x10,
+    0xa1, 0x02, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76,
+    0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60,
+    0x9b, 0x09, 0x82, 0x6c, 0x13, 0xbd, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13,
+    0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb,
+    0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x43, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1,
+    0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d,
+    0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb2, 0x0d, 0x7d,
+    0x41, 0x02, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c,
+    0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0,
+    0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x20, 0xd7, 0xcb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0,
+    0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26,
+    0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0xdb, 0x04, 0xed,
+    0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1,
+    0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b,
+    0x09, 0xdb, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0,
+    0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26,
+    0xc2, 0x60, 0x9b, 0x04, 0xed, 0xc2, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27,
+    0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6,
+    0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4f, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1,
+    0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d,
+    0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x86, 0xdb,
+    0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82,
+    0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b,
+    0x60, 0x9b, 0x20, 0xd7, 0xd4, 0x10, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09,
+    0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26,
+    0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xf6, 0x09, 0xdb, 0x04, 0xd8,
+    0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26,
+    0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x20,
+    0x83, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1,
+    0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b,
+    0x09, 0x82, 0x6c, 0x13, 0xb7, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09,
+    0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8,
+    0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xe1, 0x04, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27,
+    0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6,
+    0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xf6, 0xc1,
+    0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d,
+    0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8,
+    0x26, 0xc2, 0x1b, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82,
+    0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b,
+    0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xba, 0x08, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc2, 0x60,
+    0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x09, 0x82,
+    0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x90, 0x42, 0xd8, 0x4c,
+    0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09,
+    0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8,
+    0x27, 0x6c, 0x82, 0x0d, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2,
+    0x60, 0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30,
+    0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8,
+    0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26,
+    0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x78, 0x41, 0x30, 0x4e, 0xd8,
+    0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13,
+    0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0,
+    0x99, 0x06, 0xbe, 0x5b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60,
+    0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e,
+    0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xec, 0x6d, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0,
+    0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27,
+    0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x64, 0x10, 0xa8, 0x20, 0x98, 0x26, 0xc2,
+    0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x09,
+    0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x26,
+    0x09, 0xb2, 0x08, 0x5d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26,
+    0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04,
+    0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb2, 0x08, 0x36, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60,
+    0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4d,
+    0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0x36, 0x09, 0xdb,
+    0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82,
+    0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36,
+    0x13, 0x20, 0xd7, 0xd0, 0x82, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82,
+    0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36,
+    0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb2, 0x0d, 0x7c, 0xbb, 0x60, 0x9d, 0xb0, 0x4d,
+    0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2,
+    0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x1b, 0x60,
+    0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d,
+    0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2,
+    0x60, 0x9b, 0x20, 0x85, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09,
+    0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26,
+    0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x20, 0x85, 0x08, 0x13, 0x61, 0x30, 0x4d, 0x82,
+    0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b,
+    0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xec,
+    0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09,
+    0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed,
+    0x82, 0x6c, 0x26, 0x10, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b,
+    0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82,
+    0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x83, 0x5f, 0x42, 0x0a, 0xd8, 0x27, 0x6c, 0x13,
+    0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0,
+    0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd9, 0x06,
+    0xbe, 0x58, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27,
+    0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6,
+    0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1,
+    0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d,
+    0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4e, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0,
+    0x4d, 0x84, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1,
+    0x36, 0x13, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x84,
+    0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04,
+    0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76,
+    0xc1, 0x36, 0x13, 0x04, 0xf6, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26,
+    0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60,
+    0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x08, 0x76, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82,
+    0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36,
+    0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc8, 0x35, 0xf5, 0x04,
+    0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04,
+    0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c,
+    0x26, 0x09, 0xb0, 0x4e, 0xf6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8,
+    0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13,
+    0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x20, 0x83, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8,
+    0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13,
+    0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb7, 0x76, 0xc1,
+    0x36, 0x13, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04,
+    0xd8, 0x4c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13,
+    0x61, 0x30, 0x4d, 0xc2, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60,
+    0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e,
+    0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x7d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b,
+    0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82,
+    0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x86, 0xdb, 0x09, 0x82,
+    0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84, 0xc1, 0x36,
+    0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04,
+    0xee, 0x82, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30,
+    0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26,
+    0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x90, 0x42, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4e, 0xd8, 0x26,
+    0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61,
+    0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x82, 0x0d, 0xdb, 0x04, 0xed,
+    0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x26, 0xc2, 0x60, 0x9b, 0x04, 0xed, 0x82, 0x76, 0xc1,
+    0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b,
+    0xb0, 0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0, 0x4d, 0x84,
+    0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x36, 0x13,
+    0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9e, 0x10, 0x4c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b,
+    0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb0,
+    0x4d, 0x84, 0xc1, 0x36, 0x09, 0xdb, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x41, 0xaf, 0x96, 0xc2, 0x60,
+    0x9b, 0x04, 0xed, 0x82, 0x6c, 0x26, 0x09, 0xb0, 0x4e, 0xd8, 0x27, 0x6c, 0x13, 0x61, 0x30, 0x4d,
+    0x82, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1,
+    0x3b, 0x1b, 0x76, 0xc1, 0x36, 0x13, 0x04, 0xd8, 0x27, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26,
+    0xc1, 0x3b, 0x60, 0x9b, 0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60,
+    0x9d, 0xb0, 0x4d, 0x84, 0xc8, 0x21, 0x50, 0x41, 0x30, 0x4d, 0x82, 0x76, 0xc1, 0x3b, 0x60, 0x9b,
+    0x09, 0x82, 0x6c, 0x13, 0xb6, 0x09, 0xb0, 0x98, 0x26, 0xc1, 0x3b, 0x60, 0x9d, 0xb0, 0x4d, 0x84,
+    0xc1, 0x36, 0x09, 0xdb, 0x04, 0xd8, 0x4c, 0x13, 0x60, 0x9d, 0xb2, 0x08, 0x51, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f,
+    0xcd, 0x87, 0x4e, 0x6c, 0x1b, 0x70, 0x40, 0xe1, 0x07, 0x08, 0x38, 0x41, 0xc2, 0x0e, 0x9d, 0x38,
+    0x41, 0xd3, 0xa7, 0x4e, 0x9d, 0x3a, 0x74, 0xfd, 0x3a, 0x74, 0xfd, 0x3f, 0x4f, 0xd3, 0xf4, 0xff,
+    0xa7, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xfd, 0xaf, 0xed, 0x7b, 0x5e,
+    0xd7, 0xb5, 0xed, 0x5a, 0xb5, 0xed, 0x5a, 0xb5, 0x6a, 0xd5, 0xab, 0x50, 0xc2, 0xb5, 0x6a, 0x18,
+    0x50, 0xc2, 0x86, 0x14, 0x30, 0xa0, 0xc1, 0x4d, 0x87, 0x4e, 0x3f, 0x22, 0x8a, 0x45, 0x14, 0x8a,
+    0x29, 0x14, 0x52, 0x28, 0xa4, 0x51, 0x48, 0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29,
+    0x14, 0x52, 0x28, 0xa4, 0x51, 0x48, 0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14,
+    0x52, 0x28, 0xa4, 0x51, 0x48, 0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14, 0x52,
+    0x28, 0xa4, 0x51, 0x48, 0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14, 0x52, 0x28,
+    0xa4, 0x51, 0x48, 0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14, 0x52, 0x28, 0xa4,
+    0x51, 0x48, 0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14, 0x52, 0x28, 0xa4, 0x51,
+    0x48, 0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14, 0x52, 0x28, 0xa4, 0x51, 0x48,
+    0xa2, 0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14, 0x52, 0x28, 0xa4, 0x51, 0x48, 0xa2,
+    0x91, 0x45, 0x22, 0x8a, 0x45, 0x14, 0x8a, 0x29, 0x14, 0x52, 0x28, 0xa4, 0x51, 0x48, 0xa2, 0x91,
+    0x45, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61,
+    0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23,
+    0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46,
+    0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25,
+    0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83,
+    0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0x23, 0x0c, 0x46, 0x18, 0x25, 0x61, 0x83, 0xb0, 0xc1,
+    0x91, 0xc7, 0x23, 0x8e, 0x47, 0x1c, 0x25, 0x61, 0x83, 0x23, 0x8e, 0x47, 0x1c, 0x8e, 0x38, 0x4a,
+    0xc3, 0x06, 0x47, 0x1c, 0x8e, 0x39, 0x1c, 0x70, 0x95, 0x86, 0x0c, 0x8e, 0x39, 0x1c, 0x72, 0x38,
+    0xe1, 0x2b, 0x0c, 0x19, 0x1c, 0x72, 0x38, 0xe4, 0x71, 0xc2, 0x56, 0x18, 0x32, 0x38, 0xe4, 0x71,
+    0xc8, 0xe3, 0x84, 0xac, 0x30, 0x64, 0x71, 0xc8, 0xe3, 0x91, 0xc7, 0x09, 0x58, 0x60, 0xc8, 0xe3,
+    0x91, 0xc7, 0x23, 0x8e, 0x12, 0xb0, 0xc1, 0x91, 0xc7, 0x23, 0x8e, 0x47, 0x1c, 0x25, 0x61, 0x83,
+    0x23, 0x8e, 0x47, 0x09, 0x86, 0x0c, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x02, 0x56, 0x18,
+    0x32, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x09, 0x58, 0x60, 0xc9, 0x04, 0x12, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x25, 0x61, 0x83, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x80, 0x95, 0x86,
+    0x0c, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x02, 0x56, 0x18, 0x32, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x09, 0x58, 0x60, 0xc9, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x25, 0x61,
+    0xb0, 0xc1, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x90, 0x95, 0x86, 0x0c, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x84, 0xac, 0x30, 0x64, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x25, 0x61, 0x83, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x21, 0x2b, 0x0c, 0x19, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x09, 0x58,
+    0x60, 0xc9, 0x24, 0x92, 0x49, 0x24, 0x90, 0xc3, 0x06, 0x4a, 0x28, 0x94, 0x51, 0x28, 0xa2, 0x51,
+    0x44, 0xa2, 0x89, 0x45, 0x04, 0xac, 0x30, 0x64, 0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a,
+    0x28, 0x94, 0x50, 0x4a, 0xc3, 0x06, 0x4a, 0x28, 0x94, 0x51, 0x28, 0xa2, 0x51, 0x44, 0xa2, 0x89,
+    0x45, 0x04, 0xac, 0x30, 0x64, 0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x50,
+    0x4a, 0xc3, 0x06, 0x4a, 0x28, 0x94, 0x51, 0x28, 0x06, 0x18, 0x32, 0x59, 0x64, 0xb2, 0xc9, 0x65,
+    0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x58, 0x4a, 0xc3, 0x06, 0x4b, 0x2c, 0x96, 0x59, 0x2c,
+    0xb2, 0x59, 0x64, 0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x09, 0x58, 0x60, 0xc9, 0x65, 0x92, 0xcb, 0x25,
+    0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x61, 0x2b, 0x0c, 0x19, 0x2c, 0xb2, 0x59, 0x64,
+    0xb2, 0xc9, 0x65, 0x92, 0xc8, 0x61, 0x83, 0x26, 0x18, 0x4c, 0x30, 0x98, 0x61, 0x30, 0xc2, 0x61,
+    0x84, 0xc3, 0x09, 0x86, 0x13, 0x0c, 0x09, 0x58, 0x60, 0xc9, 0x86, 0x13, 0x0c, 0x26, 0x18, 0x4c,
+    0x30, 0x98, 0x61, 0x30, 0xc2, 0x61, 0x84, 0xc3, 0x02, 0x56, 0x18, 0x32, 0x61, 0x84, 0xc3, 0x09,
+    0x86, 0x13, 0x0c, 0x26, 0x18, 0x4c, 0x30, 0x98, 0x61, 0x30, 0xc0, 0x96, 0xc3, 0x06, 0x4d, 0x34,
+    0x9a, 0x69, 0x34, 0xd2, 0x69, 0xa4, 0xd3, 0x49, 0xa6, 0x93, 0x4d, 0x26, 0x9a, 0x4d, 0x34, 0x25,
+    0x61, 0x83, 0x26, 0x9a, 0x4d, 0x34, 0x9a, 0x69, 0x34, 0xd2, 0x69, 0xa4, 0xd3, 0x49, 0xa6, 0x93,
+    0x4d, 0x26, 0x9a, 0x12, 0xb0, 0xc1, 0x93, 0x4d, 0x26, 0x9a, 0x4d, 0x34, 0x9a, 0x69, 0x34, 0xdb,
+    0x0c, 0x19, 0x38, 0xe2, 0x71, 0xc4, 0xe3, 0x89, 0xc7, 0x13, 0x8e, 0x27, 0x1c, 0x4e, 0x38, 0x9c,
+    0x71, 0x38, 0xe2, 0x71, 0xc1, 0x2b, 0x0c, 0x19, 0x38, 0xe2, 0x71, 0xc4, 0xe3, 0x89, 0xc7, 0x13,
+    0x8e, 0x27, 0x1c, 0x4e, 0x38, 0x9c, 0x71, 0x38, 0xe2, 0x71, 0xc1, 0x2b, 0x0c, 0x19, 0x38, 0xeb,
+    0x0c, 0x19, 0x3c, 0xf2, 0x79, 0xe4, 0xf3, 0xc9, 0xe7, 0x93, 0xcf, 0x27, 0x9e, 0x4f, 0x3c, 0x9e,
+    0x79, 0x3c, 0xf2, 0x79, 0xe4, 0xf3, 0xc2, 0x56, 0x18, 0x32, 0x79, 0xe4, 0xf3, 0xc9, 0xe7, 0x93,
+    0xcf, 0x27, 0x9e, 0x4f, 0x3c, 0x9e, 0x79, 0x3c, 0xf2, 0x79, 0xe4, 0xf3, 0xc9, 0xe7, 0xd8, 0x60,
+    0xca, 0x08, 0x14, 0x10, 0x28, 0x20, 0x50, 0x40, 0xa0, 0x81, 0x41, 0x02, 0x82, 0x05, 0x04, 0x0a,
+    0x08, 0x14, 0x10, 0x28, 0x20, 0x50, 0x40, 0x25, 0x61, 0x83, 0x28, 0x20, 0x50, 0x40, 0xa0, 0x81,
+    0x41, 0x02, 0x82, 0x05, 0x04, 0x0a, 0x08, 0x14, 0x10, 0xb0, 0xc1, 0x94, 0x51, 0x28, 0xa2, 0x51,
+    0x44, 0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x51, 0x28, 0xa2, 0x51, 0x44,
+    0xa2, 0x89, 0x45, 0x10, 0x95, 0x86, 0x0c, 0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28,
+    0x94, 0x51, 0xb0, 0xc1, 0x94, 0x92, 0x29, 0x24, 0x52, 0x48, 0xa4, 0x91, 0x49, 0x22, 0x92, 0x45,
+    0x24, 0x8a, 0x49, 0x14, 0x92, 0x29, 0x24, 0x52, 0x48, 0xa4, 0x91, 0x49, 0x22, 0x92, 0x41, 0x2b,
+    0x0c, 0x19, 0x49, 0x22, 0x92, 0x45, 0x24, 0x8a, 0x44, 0x30, 0xc1, 0x94, 0xd3, 0x29, 0xa6, 0x53,
+    0x4c, 0xa6, 0x99, 0x4d, 0x32, 0x9a, 0x65, 0x34, 0xca, 0x69, 0x94, 0xd3, 0x29, 0xa6, 0x53, 0x4c,
+    0xa6, 0x99, 0x4d, 0x32, 0x9a, 0x65, 0x34, 0xc2, 0x56, 0x18, 0x32, 0x9a, 0x65, 0x30, 0x98, 0x60,
+    0xca, 0x8a, 0x15, 0x14, 0x2a, 0x28, 0x54, 0x50, 0xa8, 0xa1, 0x51, 0x42, 0xa2, 0x85, 0x45, 0x0a,
+    0x8a, 0x15, 0x14, 0x2a, 0x28, 0x54, 0x50, 0xa8, 0xa1, 0x51, 0x42, 0xa2, 0x85, 0x45, 0x02, 0x56,
+    0x1b, 0x0c, 0x19, 0x55, 0x52, 0xaa, 0xa5, 0x55, 0x4a, 0xaa, 0x95, 0x55, 0x2a, 0xaa, 0x55, 0x54,
+    0xaa, 0xa9, 0x55, 0x52, 0xaa, 0xa5, 0x55, 0x4a, 0xaa, 0x95, 0x55, 0x2a, 0xaa, 0x55, 0x54, 0xaa,
+    0xa9, 0x55, 0x50, 0xac, 0x30, 0x65, 0x65, 0x8a, 0xcb, 0x15, 0x96, 0x2b, 0x2c, 0x56, 0x58, 0xac,
+    0xb1, 0x59, 0x62, 0xb2, 0xc5, 0x65, 0x8a, 0xcb, 0x15, 0x96, 0x2b, 0x2c, 0x56, 0x58, 0xac, 0xb1,
+    0x59, 0x62, 0xb2, 0xc5, 0x62, 0x18, 0x60, 0xca, 0xeb, 0x95, 0xd7, 0x2b, 0xae, 0x57, 0x5c, 0xae,
+    0xb9, 0x5d, 0x72, 0xba, 0xe5, 0x75, 0xca, 0xeb, 0x95, 0xd7, 0x2b, 0xae, 0x57, 0x5c, 0xae, 0xb9,
+    0x5d, 0x72, 0xba, 0xe5, 0x74, 0x98, 0x60, 0xcb, 0x0c, 0x16, 0x18, 0x2c, 0x30, 0x58, 0x60, 0xb0,
+    0xc1, 0x61, 0x82, 0xc3, 0x05, 0x86, 0x0b, 0x0c, 0x16, 0x18, 0x2c, 0x30, 0x58, 0x60, 0xb0, 0xc1,
+    0x61, 0x82, 0xc3, 0x16, 0x18, 0x32, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59,
+    0x64, 0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x66,
+    0xc3, 0x06, 0x5a, 0x68, 0xb4, 0xd1, 0x69, 0xa2, 0xd3, 0x45, 0xa6, 0x8b, 0x4d, 0x16, 0x9a, 0x2d,
+    0x34, 0x5a, 0x68, 0xb4, 0xd1, 0x69, 0xa2, 0xd3, 0x45, 0xa6, 0x8b, 0x4a, 0x30, 0xc1, 0x96, 0xdb,
+    0x2d, 0xb6, 0x5b, 0x6c, 0xb6, 0xd9, 0x6d, 0xb2, 0xdb, 0x65, 0xb6, 0xcb, 0x6d, 0x96, 0xdb, 0x2d,
+    0xb6, 0x5b, 0x6c, 0xb6, 0xd9, 0x6d, 0xbb, 0x0c, 0x19, 0x71, 0xc2, 0xe3, 0x85, 0xc7, 0x0b, 0x8e,
+    0x17, 0x1c, 0x2e, 0x38, 0x5c, 0x70, 0xb8, 0xe1, 0x71, 0xc2, 0xe3, 0x85, 0xc7, 0x0b, 0x8e, 0x17,
+    0x10, 0x61, 0x83, 0x2e, 0xba, 0x5d, 0x74, 0xba, 0xe9, 0x75, 0xd2, 0xeb, 0xa5, 0xd7, 0x4b, 0xae,
+    0x97, 0x5d, 0x2e, 0xba, 0x5d, 0x74, 0xba, 0xe9, 0x75, 0xd2, 0x88, 0x0c, 0x30, 0x65, 0xe7, 0x8b,
+    0xcf, 0x17, 0x9e, 0x2f, 0x3c, 0x5e, 0x78, 0xbc, 0xf1, 0x79, 0xe2, 0xf3, 0xc5, 0xe7, 0x8b, 0xcf,
+    0x17, 0x9e, 0x2f, 0x28, 0xc3, 0x06, 0x5f, 0x7c, 0xbe, 0xf9, 0x7d, 0xf2, 0xfb, 0xe5, 0xf7, 0xcb,
+    0xef, 0x97, 0xdf, 0x2f, 0xbe, 0x5f, 0x7c, 0xbe, 0xf9, 0x7d, 0xf2, 0xc8, 0x0c, 0x30, 0x66, 0x10,
+    0x42, 0x03, 0x08, 0x21, 0x01, 0x84, 0x10, 0x80, 0xc2, 0x08, 0x40, 0x61, 0x04, 0x20, 0x30, 0x82,
+    0x10, 0x18, 0x41, 0x08, 0x0c, 0x20, 0x84, 0x06, 0x10, 0x42, 0x03, 0x08, 0x21, 0x01, 0x84, 0x10,
+    0x81, 0x86, 0x0c, 0xc2, 0x18, 0x42, 0x61, 0x0c, 0x21, 0x30, 0x86, 0x10, 0x98, 0x43, 0x08, 0x4c,
+    0x21, 0x84, 0x26, 0x10, 0xc2, 0x13, 0x08, 0x61, 0x09, 0x84, 0x30, 0x84, 0xc2, 0x18, 0x42, 0x61,
+    0x0c, 0x21, 0x30, 0x84, 0x86, 0x18, 0x33, 0x08, 0xa1, 0x11, 0x84, 0x50, 0x88, 0xc2, 0x28, 0x44,
+    0x61, 0x14, 0x22, 0x30, 0x8a, 0x11, 0x18, 0x45, 0x08, 0x8c, 0x22, 0x84, 0x46, 0x11, 0x42, 0x23,
+    0x08, 0xa1, 0x11, 0x84, 0x50, 0x88, 0xa4, 0x03, 0x0c, 0x19, 0x84, 0x70, 0x8c, 0xc2, 0x38, 0x46,
+    0x61, 0x1c, 0x23, 0x30, 0x8e, 0x11, 0x98, 0x47, 0x08, 0xcc, 0x23, 0x84, 0x66, 0x11, 0xc2, 0x33,
+    0x08, 0xe1, 0x19, 0x84, 0x70, 0x8c, 0xc2, 0x37, 0x98, 0x60, 0xcc, 0x24, 0x84, 0x86, 0x12, 0x42,
+    0x43, 0x09, 0x21, 0x21, 0x84, 0x90, 0x90, 0xc2, 0x48, 0x48, 0x61, 0x24, 0x24, 0x30, 0x92, 0x12,
+    0x18, 0x49, 0x09, 0x0c, 0x24, 0x84, 0x86, 0x12, 0x10, 0xc3, 0x06, 0x61, 0x2c, 0x25, 0x30, 0x96,
+    0x12, 0x98, 0x4b, 0x09, 0x4c, 0x25, 0x84, 0xa6, 0x12, 0xc2, 0x53, 0x09, 0x61, 0x29, 0x84, 0xb0,
+    0x94, 0xc2, 0x58, 0x4a, 0x61, 0x2c, 0x25, 0x2b, 0x80, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08,
+    0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90,
+    0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x42, 0x20, 0x82, 0x41, 0x04,
+    0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82,
+    0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08,
+    0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x42, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x22, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82,
+    0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x42, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x42, 0x20, 0x82, 0x41, 0x04, 0x82,
+    0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x42,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x22, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x42, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x42, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x42, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41,
+    0x04, 0x22, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12,
+    0x08, 0x24, 0x10, 0x42, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20,
+    0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41,
+    0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x42, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12,
+    0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x22, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20,
+    0x84, 0xae, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0,
+    0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac,
+    0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab,
+    0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a,
+    0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a,
+    0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86,
+    0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61,
+    0xab, 0x0e, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3,
+    0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0,
+    0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac,
+    0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b,
+    0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a,
+    0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12,
+    0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xd8, 0x60,
+    0xc8, 0xa2, 0x84, 0xac, 0x30, 0x64, 0x51, 0x42, 0x56, 0x18, 0x32, 0x28, 0xa1, 0x2b, 0x0c, 0x19,
+    0x14, 0x50, 0x95, 0x86, 0x0c, 0x8a, 0x28, 0x4a, 0xc3, 0x06, 0x45, 0x14, 0x25, 0x61, 0x83, 0x22,
+    0x8a, 0x12, 0xb0, 0xc1, 0x91, 0x45, 0x09, 0x58, 0x60, 0xc8, 0xa2, 0x84, 0xac, 0x30, 0x64, 0x51,
+    0x42, 0x56, 0x18, 0x32, 0x28, 0xa1, 0x2b, 0x0c, 0x19, 0x14, 0x50, 0x95, 0x86, 0x0c, 0x8a, 0x28,
+    0x4a, 0xc3, 0x06, 0x45, 0x14, 0x25, 0x61, 0x83, 0x22, 0x8a, 0x12, 0xb0, 0xc1, 0x91, 0x45, 0x09,
+    0x58, 0x60, 0xc8, 0xa2, 0x84, 0xac, 0x30, 0x64, 0x51, 0x42, 0x56, 0x18, 0x32, 0x28, 0xa1, 0x2b,
+    0x0c, 0x19, 0x14, 0x50, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31,
+    0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60,
+    0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86,
+    0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c,
+    0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18,
+    0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95, 0x86, 0x0c, 0x8c, 0x31, 0x18, 0x60, 0x95,
+    0x86, 0x0e, 0xc3, 0x06, 0x47, 0x1c, 0x8e, 0x39, 0x1c, 0x70, 0x95, 0x86, 0x0c, 0x8e, 0x39, 0x1c,
+    0x72, 0x38, 0xe1, 0x2b, 0x0c, 0x19, 0x1c, 0x72, 0x38, 0xe4, 0x71, 0xc2, 0x56, 0x18, 0x32, 0x38,
+    0xe4, 0x71, 0xc8, 0xe3, 0x84, 0xac, 0x30, 0x64, 0x71, 0xc8, 0xe3, 0x91, 0xc7, 0x09, 0x58, 0x60,
+    0xc8, 0xe3, 0x91, 0xc7, 0x23, 0x8e, 0x12, 0xb0, 0xc1, 0x91, 0xc7, 0x23, 0x8e, 0x47, 0x1c, 0x25,
+    0x61, 0x83, 0x23, 0x8e, 0x47, 0x1c, 0x8e, 0x38, 0x4a, 0xc3, 0x06, 0x47, 0x1c, 0x8e, 0x39, 0x1c,
+    0x70, 0x95, 0x86, 0x0c, 0x8e, 0x39, 0x1c, 0x26, 0x18, 0x32, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12,
+    0x08, 0x09, 0x58, 0x60, 0xc9, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x25, 0x61, 0x83, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x80, 0x95, 0x86, 0x0c, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04,
+    0x82, 0x02, 0x56, 0x18, 0x32, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x09, 0x58, 0x60, 0xc9,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x25, 0x61, 0x83, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41,
+    0x20, 0x80, 0x95, 0x86, 0xc3, 0x06, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x42,
+    0x56, 0x18, 0x32, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x12, 0xb0, 0xc1, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x90, 0x95, 0x86, 0x0c, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x84, 0xac, 0x30, 0x64, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x25, 0x61, 0x83, 0x24, 0x92, 0x49, 0x24, 0x92, 0x43, 0x0c, 0x19, 0x28, 0xa2, 0x51,
+    0x44, 0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x12, 0xb0, 0xc1, 0x92, 0x8a, 0x25, 0x14, 0x4a,
+    0x28, 0x94, 0x51, 0x28, 0xa2, 0x51, 0x41, 0x2b, 0x0c, 0x19, 0x28, 0xa2, 0x51, 0x44, 0xa2, 0x89,
+    0x45, 0x12, 0x8a, 0x25, 0x14, 0x12, 0xb0, 0xc1, 0x92, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x51,
+    0x28, 0xa2, 0x51, 0x41, 0x2b, 0x0c, 0x19, 0x28, 0xa2, 0x51, 0x44, 0xa0, 0x18, 0x60, 0xc9, 0x65,
+    0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x61, 0x2b, 0x0c, 0x19, 0x2c,
+    0xb2, 0x59, 0x64, 0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x25, 0x61, 0x83, 0x25,
+    0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x64, 0xb2, 0xc9, 0x65, 0x84, 0xac, 0x30, 0x64,
+    0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96, 0x4b, 0x21, 0x86, 0x0c, 0x98, 0x61, 0x30, 0xc2, 0x61,
+    0x84, 0xc3, 0x09, 0x86, 0x13, 0x0c, 0x26, 0x18, 0x4c, 0x30, 0x25, 0x61, 0x83, 0x26, 0x18, 0x4c,
+    0x30, 0x98, 0x61, 0x30, 0xc2, 0x61, 0x84, 0xc3, 0x09, 0x86, 0x13, 0x0c, 0x09, 0x58, 0x60, 0xc9,
+    0x86, 0x13, 0x0c, 0x26, 0x18, 0x4c, 0x30, 0x98, 0x61, 0x30, 0xc2, 0x61, 0x84, 0xc3, 0x02, 0x5b,
+    0x0c, 0x19, 0x34, 0xd2, 0x69, 0xa4, 0xd3, 0x49, 0xa6, 0x93, 0x4d, 0x26, 0x9a, 0x4d, 0x34, 0x9a,
+    0x69, 0x34, 0xd0, 0x95, 0x86, 0x0c, 0x9a, 0x69, 0x34, 0xd2, 0x69, 0xa4, 0xd3, 0x49, 0xa6, 0x93,
+    0x4d, 0x26, 0x9a, 0x4d, 0x34, 0x9a, 0x68, 0x4a, 0xc3, 0x06, 0x4d, 0x34, 0x9a, 0x69, 0x34, 0xd2,
+    0x69, 0xa4, 0xd3, 0x6c, 0x30, 0x64, 0xe3, 0x89, 0xc7, 0x13, 0x8e, 0x27, 0x1c, 0x4e, 0x38, 0x9c,
+    0x71, 0x38, 0xe2, 0x71, 0xc4, 0xe3, 0x89, 0xc7, 0x04, 0xac, 0x30, 0x64, 0xe3, 0x89, 0xc7, 0x13,
+    0x8e, 0x27, 0x1c, 0x4e, 0x38, 0x9c, 0x71, 0x38, 0xe2, 0x71, 0xc4, 0xe3, 0x89, 0xc7, 0x04, 0xac,
+    0x30, 0x64, 0xe3, 0xac, 0x30, 0x64, 0xf3, 0xc9, 0xe7, 0x93, 0xcf, 0x27, 0x9e, 0x4f, 0x3c, 0x9e,
+    0x79, 0x3c, 0xf2, 0x79, 0xe4, 0xf3, 0xc9, 0xe7, 0x93, 0xcf, 0x09, 0x58, 0x60, 0xc9, 0xe7, 0x93,
+    0xcf, 0x27, 0x9e, 0x4f, 0x3c, 0x9e, 0x79, 0x3c, 0xf2, 0x79, 0xe4, 0xf3, 0xc9, 0xe7, 0x93, 0xcf,
+    0x27, 0x9f, 0x61, 0x83, 0x28, 0x20, 0x50, 0x40, 0xa0, 0x81, 0x41, 0x02, 0x82, 0x05, 0x04, 0x0a,
+    0x08, 0x14, 0x10, 0x28, 0x20, 0x50, 0x40, 0xa0, 0x81, 0x41, 0x00, 0x95, 0x86, 0x0c, 0xa0, 0x81,
+    0x41, 0x02, 0x82, 0x05, 0x04, 0x0a, 0x08, 0x14, 0x10, 0x28, 0x20, 0x50, 0x42, 0xc3, 0x06, 0x51,
+    0x44, 0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x51, 0x28, 0xa2, 0x51, 0x44,
+    0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x42, 0x56, 0x18, 0x32, 0x8a, 0x25, 0x14, 0x4a, 0x28,
+    0x94, 0x51, 0x28, 0xa2, 0x51, 0x46, 0xc3, 0x06, 0x52, 0x48, 0xa4, 0x91, 0x49, 0x22, 0x92, 0x45,
+    0x24, 0x8a, 0x49, 0x14, 0x92, 0x29, 0x24, 0x52, 0x48, 0xa4, 0x91, 0x49, 0x22, 0x92, 0x45, 0x24,
+    0x8a, 0x49, 0x04, 0xac, 0x30, 0x65, 0x24, 0x8a, 0x49, 0x14, 0x92, 0x29, 0x10, 0xc3, 0x06, 0x53,
+    0x4c, 0xa6, 0x99, 0x4d, 0x32, 0x9a, 0x65, 0x34, 0xca, 0x69, 0x94, 0xd3, 0x29, 0xa6, 0x53, 0x4c,
+    0xa6, 0x99, 0x4d, 0x32, 0x9a, 0x65, 0x34, 0xca, 0x69, 0x94, 0xd3, 0x09, 0x58, 0x60, 0xca, 0x69,
+    0x94, 0xc2, 0x61, 0x83, 0x2a, 0x28, 0x54, 0x50, 0xa8, 0xa1, 0x51, 0x42, 0xa2, 0x85, 0x45, 0x0a,
+    0x8a, 0x15, 0x14, 0x2a, 0x28, 0x54, 0x50, 0xa8, 0xa1, 0x51, 0x42, 0xa2, 0x85, 0x45, 0x0a, 0x8a,
+    0x15, 0x14, 0x09, 0x58, 0x6c, 0x30, 0x65, 0x55, 0x4a, 0xaa, 0x95, 0x55, 0x2a, 0xaa, 0x55, 0x54,
+    0xaa, 0xa9, 0x55, 0x52, 0xaa, 0xa5, 0x55, 0x4a, 0xaa, 0x95, 0x55, 0x2a, 0xaa, 0x55, 0x54, 0xaa,
+    0xa9, 0x55, 0x52, 0xaa, 0xa5, 0x55, 0x42, 0xb0, 0xc1, 0x95, 0x96, 0x2b, 0x2c, 0x56, 0x58, 0xac,
+    0xb1, 0x59, 0x62, 0xb2, 0xc5, 0x65, 0x8a, 0xcb, 0x15, 0x96, 0x2b, 0x2c, 0x56, 0x58, 0xac, 0xb1,
+    0x59, 0x62, 0xb2, 0xc5, 0x65, 0x8a, 0xcb, 0x15, 0x88, 0x61, 0x83, 0x2b, 0xae, 0x57, 0x5c, 0xae,
+    0xb9, 0x5d, 0x72, 0xba, 0xe5, 0x75, 0xca, 0xeb, 0x95, 0xd7, 0x2b, 0xae, 0x57, 0x5c, 0xae, 0xb9,
+    0x5d, 0x72, 0xba, 0xe5, 0x75, 0xca, 0xeb, 0x95, 0xd2, 0x61, 0x83, 0x2c, 0x30, 0x58, 0x60, 0xb0,
+    0xc1, 0x61, 0x82, 0xc3, 0x05, 0x86, 0x0b, 0x0c, 0x16, 0x18, 0x2c, 0x30, 0x58, 0x60, 0xb0, 0xc1,
+    0x61, 0x82, 0xc3, 0x05, 0x86, 0x0b, 0x0c, 0x58, 0x60, 0xcb, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59,
+    0x64, 0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x64,
+    0xb2, 0xc9, 0x65, 0x9b, 0x0c, 0x19, 0x69, 0xa2, 0xd3, 0x45, 0xa6, 0x8b, 0x4d, 0x16, 0x9a, 0x2d,
+    0x34, 0x5a, 0x68, 0xb4, 0xd1, 0x69, 0xa2, 0xd3, 0x45, 0xa6, 0x8b, 0x4d, 0x16, 0x9a, 0x2d, 0x28,
+    0xc3, 0x06, 0x5b, 0x6c, 0xb6, 0xd9, 0x6d, 0xb2, 0xdb, 0x65, 0xb6, 0xcb, 0x6d, 0x96, 0xdb, 0x2d,
+    0xb6, 0x5b, 0x6c, 0xb6, 0xd9, 0x6d, 0xb2, 0xdb, 0x65, 0xb6, 0xec, 0x30, 0x65, 0xc7, 0x0b, 0x8e,
+    0x17, 0x1c, 0x2e, 0x38, 0x5c, 0x70, 0xb8, 0xe1, 0x71, 0xc2, 0xe3, 0x85, 0xc7, 0x0b, 0x8e, 0x17,
+    0x1c, 0x2e, 0x38, 0x5c, 0x41, 0x86, 0x0c, 0xba, 0xe9, 0x75, 0xd2, 0xeb, 0xa5, 0xd7, 0x4b, 0xae,
+    0x97, 0x5d, 0x2e, 0xba, 0x5d, 0x74, 0xba, 0xe9, 0x75, 0xd2, 0xeb, 0xa5, 0xd7, 0x4a, 0x20, 0x30,
+    0xc1, 0x97, 0x9e, 0x2f, 0x3c, 0x5e, 0x78, 0xbc, 0xf1, 0x79, 0xe2, 0xf3, 0xc5, 0xe7, 0x8b, 0xcf,
+    0x17, 0x9e, 0x2f, 0x3c, 0x5e, 0x78, 0xbc, 0xa3, 0x0c, 0x19, 0x7d, 0xf2, 0xfb, 0xe5, 0xf7, 0xcb,
+    0xef, 0x97, 0xdf, 0x2f, 0xbe, 0x5f, 0x7c, 0xbe, 0xf9, 0x7d, 0xf2, 0xfb, 0xe5, 0xf7, 0xcb, 0x20,
+    0x30, 0xc1, 0x98, 0x41, 0x08, 0x0c, 0x20, 0x84, 0x06, 0x10, 0x42, 0x03, 0x08, 0x21, 0x01, 0x84,
+    0x10, 0x80, 0xc2, 0x08, 0x40, 0x61, 0x04, 0x20, 0x30, 0x82, 0x10, 0x18, 0x41, 0x08, 0x0c, 0x20,
+    0x84, 0x06, 0x10, 0x42, 0x06, 0x18, 0x33, 0x08, 0x61, 0x09, 0x84, 0x30, 0x84, 0xc2, 0x18, 0x42,
+    0x61, 0x0c, 0x21, 0x30, 0x86, 0x10, 0x98, 0x43, 0x08, 0x4c, 0x21, 0x84, 0x26, 0x10, 0xc2, 0x13,
+    0x08, 0x61, 0x09, 0x84, 0x30, 0x84, 0xc2, 0x12, 0x18, 0x60, 0xcc, 0x22, 0x84, 0x46, 0x11, 0x42,
+    0x23, 0x08, 0xa1, 0x11, 0x84, 0x50, 0x88, 0xc2, 0x28, 0x44, 0x61, 0x14, 0x22, 0x30, 0x8a, 0x11,
+    0x18, 0x45, 0x08, 0x8c, 0x22, 0x84, 0x46, 0x11, 0x42, 0x22, 0x90, 0x0c, 0x30, 0x66, 0x11, 0xc2,
+    0x33, 0x08, 0xe1, 0x19, 0x84, 0x70, 0x8c, 0xc2, 0x38, 0x46, 0x61, 0x1c, 0x23, 0x30, 0x8e, 0x11,
+    0x98, 0x47, 0x08, 0xcc, 0x23, 0x84, 0x66, 0x11, 0xc2, 0x33, 0x08, 0xde, 0x61, 0x83, 0x30, 0x92,
+    0x12, 0x18, 0x49, 0x09, 0x0c, 0x24, 0x84, 0x86, 0x12, 0x42, 0x43, 0x09, 0x21, 0x21, 0x84, 0x90,
+    0x90, 0xc2, 0x48, 0x48, 0x61, 0x24, 0x24, 0x30, 0x92, 0x12, 0x18, 0x48, 0x43, 0x0c, 0x19, 0x84,
+    0xb0, 0x94, 0xc2, 0x58, 0x4a, 0x61, 0x2c, 0x25, 0x30, 0x96, 0x12, 0x98, 0x4b, 0x09, 0x4c, 0x25,
+    0x84, 0xa6, 0x12, 0xc2, 0x53, 0x09, 0x61, 0x29, 0x84, 0xb0, 0x94, 0xae, 0x01, 0x04, 0x12, 0x08,
+    0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x10, 0x88, 0x20, 0x90,
+    0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x08,
+    0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82,
+    0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x10, 0x88, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x08, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x10, 0x88, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82,
+    0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x08, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24,
+    0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x10, 0x88, 0x20, 0x90, 0x41,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x08, 0x82,
+    0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x10, 0x88, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x08, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x10, 0x88, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x08, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10,
+    0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x10, 0x88, 0x20, 0x90, 0x41, 0x20,
+    0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x08, 0x82, 0x09,
+    0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x10,
+    0x88, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20,
+    0x90, 0x41, 0x08, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41,
+    0x04, 0x82, 0x09, 0x04, 0x10, 0x88, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12,
+    0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x08, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20,
+    0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x10, 0x88, 0x20, 0x90, 0x41, 0x20, 0x82,
+    0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41,
+    0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x08, 0x82, 0x09, 0x04,
+    0x12, 0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12,
+    0x08, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x10, 0x88,
+    0x20, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x09, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20,
+    0x90, 0x41, 0x20, 0x82, 0x12, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab,
+    0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a,
+    0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a,
+    0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86,
+    0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61,
+    0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58,
+    0x6a, 0xc3, 0x56, 0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x35, 0x61, 0xab, 0x0d, 0x58, 0x6a, 0xc3, 0x56,
+    0x1a, 0xb0, 0xd5, 0x86, 0xac, 0x3b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac,
+    0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b,
+    0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a,
+    0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12,
+    0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84,
+    0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61,
+    0x2b, 0x0c, 0x18, 0x4a, 0xc3, 0x06, 0x12, 0xb0, 0xc1, 0x84, 0xac, 0x30, 0x61, 0x2b, 0x0c, 0x18,
+    0x4a, 0xc3, 0x61, 0x83, 0x22, 0x8a, 0x12, 0xb0, 0xc1, 0x91, 0x45, 0x09, 0x58, 0x60, 0xc8, 0xa2,
+    0x84, 0xac, 0x30, 0x64, 0x51, 0x42, 0x56, 0x18, 0x32, 0x28, 0xa1, 0x2b, 0x0c, 0x19, 0x14, 0x50,
+    0x95, 0x86, 0x0c, 0x8a, 0x28, 0x4a, 0xc3, 0x06, 0x45, 0x14, 0x25, 0x61, 0x83, 0x22, 0x8a, 0x12,
+    0xb0, 0xc1, 0x91, 0x45, 0x09, 0x58, 0x60, 0xc8, 0xa2, 0x84, 0xac, 0x30, 0x64, 0x51, 0x42, 0x56,
+    0x18, 0x32, 0x28, 0xa1, 0x2b, 0x0c, 0x19, 0x14, 0x50, 0x95, 0x86, 0x0c, 0x8a, 0x28, 0x4a, 0xc3,
+    0x06, 0x45, 0x14, 0x25, 0x61, 0x83, 0x22, 0x8a, 0x12, 0xb0, 0xc1, 0x91, 0x45, 0x09, 0x58, 0x60,
+    0xc8, 0xa2, 0x84, 0xac, 0x30, 0x64, 0x51, 0x42, 0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56,
+    0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32,
+    0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32, 0x30, 0xc4,
+    0x61, 0x82, 0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82,
+    0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18,
+    0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32, 0x30, 0xc4, 0x61, 0x82, 0x56, 0x18, 0x32, 0x30,
+    0xc4, 0x61, 0x82, 0x56, 0x18, 0x3b, 0x0c, 0x19, 0x1c, 0x72, 0x38, 0xe4, 0x71, 0xc2, 0x56, 0x18,
+    0x32, 0x38, 0xe4, 0x71, 0xc8, 0xe3, 0x84, 0xac, 0x30, 0x64, 0x71, 0xc8, 0xe3, 0x91, 0xc7, 0x09,
+    0x58, 0x60, 0xc8, 0xe3, 0x91, 0xc7, 0x23, 0x8e, 0x12, 0xb0, 0xc1, 0x91, 0xc7, 0x23, 0x8e, 0x47,
+    0x1c, 0x25, 0x61, 0x83, 0x23, 0x8e, 0x47, 0x1c, 0x8e, 0x38, 0x4a, 0xc3, 0x06, 0x47, 0x1c, 0x8e,
+    0x39, 0x1c, 0x70, 0x95, 0x86, 0x0c, 0x8e, 0x39, 0x1c, 0x72, 0x38, 0xe1, 0x2b, 0x0c, 0x19, 0x1c,
+    0x72, 0x38, 0xe4, 0x71, 0xc2, 0x56, 0x18, 0x32, 0x38, 0xe4, 0x70, 0x98, 0x60, 0xc9, 0x04, 0x12,
+    0x08, 0x24, 0x10, 0x48, 0x20, 0x25, 0x61, 0x83, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x80,
+    0x95, 0x86, 0x0c, 0x90, 0x41, 0x20, 0x82, 0x41, 0x04, 0x82, 0x02, 0x56, 0x18, 0x32, 0x41, 0x04,
+    0x82, 0x09, 0x04, 0x12, 0x08, 0x09, 0x58, 0x60, 0xc9, 0x04, 0x12, 0x08, 0x24, 0x10, 0x48, 0x20,
+    0x25, 0x61, 0x83, 0x24, 0x10, 0x48, 0x20, 0x90, 0x41, 0x20, 0x80, 0x95, 0x86, 0x0c, 0x90, 0x41,
+    0x20, 0x82, 0x41, 0x04, 0x82, 0x02, 0x56, 0x1b, 0x0c, 0x19, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x09, 0x58, 0x60, 0xc9, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x48,
+    0x4a, 0xc3, 0x06, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x42, 0x56, 0x18, 0x32,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x12, 0xb0, 0xc1, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x90, 0x95, 0x86, 0x0c, 0x92, 0x49, 0x24, 0x92, 0x49, 0x0c, 0x30,
+    0x64, 0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x50, 0x4a, 0xc3, 0x06, 0x4a,
+    0x28, 0x94, 0x51, 0x28, 0xa2, 0x51, 0x44, 0xa2, 0x89, 0x45, 0x04, 0xac, 0x30, 0x64, 0xa2, 0x89,
+    0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x50, 0x4a, 0xc3, 0x06, 0x4a, 0x28, 0x94, 0x51,
+    0x28, 0xa2, 0x51, 0x44, 0xa2, 0x89, 0x45, 0x04, 0xac, 0x30, 0x64, 0xa2, 0x89, 0x45, 0x12, 0x80,
+    0x61, 0x83, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x64, 0xb2, 0xc9, 0x65, 0x84,
+    0xac, 0x30, 0x64, 0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb0,
+    0x95, 0x86, 0x0c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x64, 0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96,
+    0x12, 0xb0, 0xc1, 0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0x86, 0x18, 0x32, 0x61,
+    0x84, 0xc3, 0x09, 0x86, 0x13, 0x0c, 0x26, 0x18, 0x4c, 0x30, 0x98, 0x61, 0x30, 0xc0, 0x95, 0x86,
+    0x0c, 0x98, 0x61, 0x30, 0xc2, 0x61, 0x84, 0xc3, 0x09, 0x86, 0x13, 0x0c, 0x26, 0x18, 0x4c, 0x30,
+    0x25, 0x61, 0x83, 0x26, 0x18, 0x4c, 0x30, 0x98, 0x61, 0x30, 0xc2, 0x61, 0x84, 0xc3, 0x09, 0x86,
+    0x13, 0x0c, 0x09, 0x6c, 0x30, 0x64, 0xd3, 0x49, 0xa6, 0x93, 0x4d, 0x26, 0x9a, 0x4d, 0x34, 0x9a,
+    0x69, 0x34, 0xd2, 0x69, 0xa4, 0xd3, 0x42, 0x56, 0x18, 0x32, 0x69, 0xa4, 0xd3, 0x49, 0xa6, 0x93,
+    0x4d, 0x26, 0x9a, 0x4d, 0x34, 0x9a, 0x69, 0x34, 0xd2, 0x69, 0xa1, 0x2b, 0x0c, 0x19, 0x34, 0xd2,
+    0x69, 0xa4, 0xd3, 0x49, 0xa6, 0x93, 0x4d, 0xb0, 0xc1, 0x93, 0x8e, 0x27, 0x1c, 0x4e, 0x38, 0x9c,
+    0x71, 0x38, 0xe2, 0x71, 0xc4, 0xe3, 0x89, 0xc7, 0x13, 0x8e, 0x27, 0x1c, 0x12, 0xb0, 0xc1, 0x93,
+    0x8e, 0x27, 0x1c, 0x4e, 0x38, 0x9c, 0x71, 0x38, 0xe2, 0x71, 0xc4, 0xe3, 0x89, 0xc7, 0x13, 0x8e,
+    0x27, 0x1c, 0x12, 0xb0, 0xc1, 0x93, 0x8e, 0xb0, 0xc1, 0x93, 0xcf, 0x27, 0x9e, 0x4f, 0x3c, 0x9e,
+    0x79, 0x3c, 0xf2, 0x79, 0xe4, 0xf3, 0xc9, 0xe7, 0x93, 0xcf, 0x27, 0x9e, 0x4f, 0x3c, 0x25, 0x61,
+    0x83, 0x27, 0x9e, 0x4f, 0x3c, 0x9e, 0x79, 0x3c, 0xf2, 0x79, 0xe4, 0xf3, 0xc9, 0xe7, 0x93, 0xcf,
+    0x27, 0x9e, 0x4f, 0x3c, 0x9e, 0x7d, 0x86, 0x0c, 0xa0, 0x81, 0x41, 0x02, 0x82, 0x05, 0x04, 0x0a,
+    0x08, 0x14, 0x10, 0x28, 0x20, 0x50, 0x40, 0xa0, 0x81, 0x41, 0x02, 0x82, 0x05, 0x04, 0x02, 0x56,
+    0x18, 0x32, 0x82, 0x05, 0x04, 0x0a, 0x08, 0x14, 0x10, 0x28, 0x20, 0x50, 0x40, 0xa0, 0x81, 0x41,
+    0x0b, 0x0c, 0x19, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x51, 0x28, 0xa2, 0x51, 0x44,
+    0xa2, 0x89, 0x45, 0x12, 0x8a, 0x25, 0x14, 0x4a, 0x28, 0x94, 0x51, 0x09, 0x58, 0x60, 0xca, 0x28,
+    0x94, 0x51, 0x28, 0xa2, 0x51, 0x44, 0xa2, 0x89, 0x45, 0x1b, 0x0c, 0x19, 0x49, 0x22, 0x92, 0x45,
+    0x24, 0x8a, 0x49, 0x14, 0x92, 0x29, 0x24, 0x52, 0x48, 0xa4, 0x91, 0x49, 0x22, 0x92, 0x45, 0x24,
+    0x8a, 0x49, 0x14, 0x92, 0x29, 0x24, 0x12, 0xb0, 0xc1, 0x94, 0x92, 0x29, 0x24, 0x52, 0x48, 0xa4,
+    0x43, 0x0c, 0x19, 0x4d, 0x32, 0x9a, 0x65, 0x34, 0xca, 0x69, 0x94, 0xd3, 0x29, 0xa6, 0x53, 0x4c,
+    0xa6, 0x99, 0x4d, 0x32, 0x9a, 0x65, 0x34, 0xca, 0x69, 0x94, 0xd3, 0x29, 0xa6, 0x53, 0x4c, 0x25,
+    0x61, 0x83, 0x29, 0xa6, 0x53, 0x09, 0x86, 0x0c, 0xa8, 0xa1, 0x51, 0x42, 0xa2, 0x85, 0x45, 0x0a,
+    0x8a, 0x15, 0x14, 0x2a, 0x28, 0x54, 0x50, 0xa8, 0xa1, 0x51, 0x42, 0xa2, 0x85, 0x45, 0x0a, 0x8a,
+    0x15, 0x14, 0x2a, 0x28, 0x54, 0x50, 0x25, 0x61, 0xb0, 0xc1, 0x95, 0x55, 0x2a, 0xaa, 0x55, 0x54,
+    0xaa, 0xa9, 0x55, 0x52, 0xaa, 0xa5, 0x55, 0x4a, 0xaa, 0x95, 0x55, 0x2a, 0xaa, 0x55, 0x54, 0xaa,
+    0xa9, 0x55, 0x52, 0xaa, 0xa5, 0x55, 0x4a, 0xaa, 0x95, 0x55, 0x0a, 0xc3, 0x06, 0x56, 0x58, 0xac,
+    0xb1, 0x59, 0x62, 0xb2, 0xc5, 0x65, 0x8a, 0xcb, 0x15, 0x96, 0x2b, 0x2c, 0x56, 0x58, 0xac, 0xb1,
+    0x59, 0x62, 0xb2, 0xc5, 0x65, 0x8a, 0xcb, 0x15, 0x96, 0x2b, 0x2c, 0x56, 0x21, 0x86, 0x0c, 0xae,
+    0xb9, 0x5d, 0x72, 0xba, 0xe5, 0x75, 0xca, 0xeb, 0x95, 0xd7, 0x2b, 0xae, 0x57, 0x5c, 0xae, 0xb9,
+    0x5d, 0x72, 0xba, 0xe5, 0x75, 0xca, 0xeb, 0x95, 0xd7, 0x2b, 0xae, 0x57, 0x49, 0x86, 0x0c, 0xb0,
+    0xc1, 0x61, 0x82, 0xc3, 0x05, 0x86, 0x0b, 0x0c, 0x16, 0x18, 0x2c, 0x30, 0x58, 0x60, 0xb0, 0xc1,
+    0x61, 0x82, 0xc3, 0x05, 0x86, 0x0b, 0x0c, 0x16, 0x18, 0x2c, 0x31, 0x61, 0x83, 0x2c, 0xb2, 0x59,
+    0x64, 0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96, 0x4b, 0x2c, 0x96, 0x59, 0x2c, 0xb2, 0x59, 0x64,
+    0xb2, 0xc9, 0x65, 0x92, 0xcb, 0x25, 0x96, 0x6c, 0x30, 0x65, 0xa6, 0x8b, 0x4d, 0x16, 0x9a, 0x2d,
+    0x34, 0x5a, 0x68, 0xb4, 0xd1, 0x69, 0xa2, 0xd3, 0x45, 0xa6, 0x8b, 0x4d, 0x16, 0x9a, 0x2d, 0x34,
+    0x5a, 0x68, 0xb4, 0xa3, 0x0c, 0x19, 0x6d, 0xb2, 0xdb, 0x65, 0xb6, 0xcb, 0x6d, 0x96, 0xdb, 0x2d,
+    0xb6, 0x5b, 0x6c, 0xb6, 0xd9, 0x6d, 0xb2, 0xdb, 0x65, 0xb6, 0xcb, 0x6d, 0x96, 0xdb, 0xb0, 0xc1,
+    0x97, 0x1c, 0x2e, 0x38, 0x5c, 0x70, 0xb8, 0xe1, 0x71, 0xc2, 0xe3, 0x85, 0xc7, 0x0b, 0x8e, 0x17,
+    0x1c, 0x2e, 0x38, 0x5c, 0x70, 0xb8, 0xe1, 0x71, 0x06, 0x18, 0x32, 0xeb, 0xa5, 0xd7, 0x4b, 0xae,
+    0x97, 0x5d, 0x2e, 0xba, 0x5d, 0x74, 0xba, 0xe9, 0x75, 0xd2, 0xeb, 0xa5, 0xd7, 0x4b, 0xae, 0x97,
+    0x5d, 0x28, 0x80, 0xc3, 0x06, 0x5e, 0x78, 0xbc, 0xf1, 0x79, 0xe2, 0xf3, 0xc5, 0xe7, 0x8b, 0xcf,
+    0x17, 0x9e, 0x2f, 0x3c, 0x5e, 0x78, 0xbc, 0xf1, 0x79, 0xe2, 0xf2, 0x84, 0x02, 0x84, 0xc2, 0x52,
+    0x84, 0x9c, 0x50, 0x98, 0x66, 0x50, 0x84, 0x4a, 0x8a, 0xe4, 0xa8, 0xae, 0x4a, 0x8a, 0xe4, 0xa8,
+    0xae, 0x4a, 0x3a, 0xee, 0xee, 0xee, 0xee, 0xf7, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11,
+    0x19, 0x00, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31,
+    0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x1d, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xef,
+    0x77, 0x77, 0x77, 0x77, 0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee,
+    0xee, 0xee, 0xf7, 0x77, 0x77, 0x77, 0x77, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xee, 0xee, 0xee, 0xee, 0xef, 0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x90, 0x01,
+    0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31,
+    0x80, 0x13, 0x18, 0x01, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xf7, 0x77, 0x77,
+    0x77, 0x77, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xef,
+    0x77, 0x77, 0x77, 0x77, 0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee,
+    0xee, 0xee, 0xf7, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x19, 0x00, 0x13, 0x18, 0x01,
+    0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31,
+    0x80, 0x1d, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xef, 0x77, 0x77, 0x77, 0x77, 0x7b,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xf7, 0x77, 0x77,
+    0x77, 0x77, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xef,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x90, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01,
+    0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xf7, 0x77, 0x77, 0x77, 0x77, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xef, 0x77, 0x77, 0x77, 0x77, 0x7b,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xf7, 0x77, 0x77,
+    0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x19, 0x00, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01,
+    0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x1d, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xee, 0xee, 0xee, 0xee, 0xef, 0x77, 0x77, 0x77, 0x77, 0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xf7, 0x77, 0x77, 0x77, 0x77, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xef, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0x11, 0x11, 0x11, 0x11, 0x90, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01,
+    0x31, 0x80, 0x13, 0x18, 0x01, 0x31, 0x80, 0x13, 0x18, 0x01, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xee,
+    0xee, 0xee, 0xee, 0xf7, 0x77, 0x77, 0x77, 0x77, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xee, 0xee, 0xee, 0xee, 0xef, 0x77, 0x77, 0x77, 0x77, 0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xde, 0xee, 0xee, 0xee, 0xee, 0xe0,
+};
+
+#endif // G5_FIXTURE_H
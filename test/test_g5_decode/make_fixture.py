@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Regenerate g5_fixture.h from tools/g5_pack.py.
+
+The pattern below must stay identical to pattern_black() in
+g5_decode.test.cpp. Run after any change to the packer:
+
+    python test/test_g5_decode/make_fixture.py
+"""
+
+import sys
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+sys.path.insert(0, str(HERE.parent.parent / "tools"))
+
+import g5_pack  # noqa: E402
+
+WIDTH, HEIGHT = g5_pack.PROFILES["og"]
+
+
+def pattern_black(x, y):
+    """Bands that exercise vertical, pass and short/long horizontal codes."""
+    if y < 60:
+        return ((x + y) // 8) % 2 == 1                    # diagonals: vertical modes
+    if y < 120:
+        return 100 <= x < 700 and y % 20 < 12              # long runs
+    if y < 200:
+        if not 300 <= x < 420:
+            return False
+        h = ((x * 7 + y * 13) * 2654435761) & 0xFFFFFFFF   # noise: short runs
+        return (h >> 13) & 1 == 1
+    if y < 300:
+        return (x - 400) ** 2 + (y - 250) ** 2 < 45 ** 2   # disc: growing/shrinking edges
+    if y < 400:
+        return (x // (1 + y % 37)) % 2 == 1                # stripes of varying width
+    return x % 97 < y % 13                                 # short ticks: pass modes
+
+
+def main():
+    rows = [[pattern_black(x, y) for x in range(WIDTH)] for y in range(HEIGHT)]
+    packed = g5_pack.pack(rows, WIDTH, HEIGHT)
+    if g5_pack.decode_rows(packed[g5_pack.HEADER_SIZE:], WIDTH, HEIGHT) != rows:
+        raise SystemExit("round-trip check failed")
+
+    lines = [
+        "// Generated by make_fixture.py from tools/g5_pack.py — do not edit",
+        "#ifndef G5_FIXTURE_H",
+        "#define G5_FIXTURE_H",
+        "",
+        f"#define G5_FIXTURE_WIDTH {WIDTH}",
+        f"#define G5_FIXTURE_HEIGHT {HEIGHT}",
+        "",
+        "static const uint8_t g5_fixture[] = {",
+    ]
+    for i in range(0, len(packed), 16):
+        lines.append("    " + " ".join(f"0x{b:02x}," for b in packed[i:i + 16]))
+    lines += ["};", "", "#endif // G5_FIXTURE_H", ""]
+    (HERE / "g5_fixture.h").write_text("\n".join(lines), encoding="utf-8")
+    print(f"g5_fixture.h: {len(packed)} bytes", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,116 @@
+#include <unity.h>
+#include <string.h>
+
+// Include implementation directly for native testing (slot table logic only)
+#include "../../src/image_slots.cpp"
+
+#define SLOT_SIZE 4096
+#define SLOTS 4
+
+static ImageSlotHeader slots[SLOTS];
+
+static void erase_all()
+{
+    memset(slots, 0xFF, sizeof(slots));
+}
+
+static void put(int i, uint32_t key, uint32_t seq, uint32_t erases)
+{
+    memset(&slots[i], 0, sizeof(ImageSlotHeader));
+    slots[i].magic = IMAGE_SLOT_MAGIC;
+    slots[i].seq = seq;
+    slots[i].key = key;
+    slots[i].size = 100;
+    slots[i].erase_count = erases;
+}
+
+void setUp(void)
+{
+    erase_all();
+}
+
+void tearDown(void) {}
+
+void test_header_is_32_bytes(void)
+{
+    TEST_ASSERT_EQUAL(IMAGE_SLOT_HEADER_SIZE, sizeof(ImageSlotHeader));
+}
+
+void test_find_returns_newest_copy(void)
+{
+    put(0, 7, 3, 1);
+    put(2, 7, 5, 1);
+    put(3, 9, 4, 1);
+    TEST_ASSERT_EQUAL(2, image_slots_find(slots, SLOTS, SLOT_SIZE, 7));
+    TEST_ASSERT_EQUAL(3, image_slots_find(slots, SLOTS, SLOT_SIZE, 9));
+    TEST_ASSERT_EQUAL(-1, image_slots_find(slots, SLOTS, SLOT_SIZE, 1));
+}
+
+void test_incomplete_or_oversized_slot_ignored(void)
+{
+    put(0, 7, 3, 1);
+    slots[0].magic = 0xFFFFFFFF;  // power cut before the magic was written
+    put(1, 7, 2, 1);
+    slots[1].size = SLOT_SIZE;    // can't fit behind the header
+    TEST_ASSERT_EQUAL(-1, image_slots_find(slots, SLOTS, SLOT_SIZE, 7));
+    TEST_ASSERT_EQUAL(1, image_slots_next_seq(slots, SLOTS, SLOT_SIZE));
+}
+
+void test_pick_prefers_unused_with_fewest_erases(void)
+{
+    put(0, 7, 1, 1);
+    slots[2].erase_count = 3;  // erased but abandoned
+    slots[3].erase_count = 1;
+    slots[1].erase_count = 2;
+    TEST_ASSERT_EQUAL(3, image_slots_pick(slots, SLOTS, SLOT_SIZE, 9));
+}
+
+void test_pick_then_superseded_then_oldest(void)
+{
+    put(0, 7, 1, 1);
+    put(1, 7, 4, 1);  // current copy of 7; slot 0 is superseded
+    put(2, 8, 2, 1);
+    put(3, 9, 3, 1);
+    TEST_ASSERT_EQUAL(0, image_slots_pick(slots, SLOTS, SLOT_SIZE, 8));
+
+    put(0, 6, 5, 1);  // now every slot is live — evict the oldest write
+    TEST_ASSERT_EQUAL(2, image_slots_pick(slots, SLOTS, SLOT_SIZE, 9));
+}
+
+void test_pick_never_overwrites_current_copy(void)
+{
+    put(0, 7, 1, 1);
+    put(1, 8, 2, 1);
+    TEST_ASSERT_EQUAL(1, image_slots_pick(slots, 2, SLOT_SIZE, 7));
+    TEST_ASSERT_EQUAL(0, image_slots_pick(slots, 2, SLOT_SIZE, 8));
+    TEST_ASSERT_EQUAL(-1, image_slots_pick(slots, 1, SLOT_SIZE, 9));
+}
+
+void test_writes_rotate_across_slots(void)
+{
+    // Rewriting one screen over and over must touch every slot evenly
+    uint32_t erases[SLOTS] = {0};
+    for (int round = 0; round < SLOTS * 10; round++)
+    {
+        int slot = image_slots_pick(slots, SLOTS, SLOT_SIZE, 7);
+        TEST_ASSERT_TRUE(slot >= 0);
+        uint32_t seq = image_slots_next_seq(slots, SLOTS, SLOT_SIZE);
+        erases[slot]++;
+        put(slot, 7, seq, erases[slot]);
+    }
+    for (int i = 0; i < SLOTS; i++)
+        TEST_ASSERT_EQUAL(10, erases[i]);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_header_is_32_bytes);
+    RUN_TEST(test_find_returns_newest_copy);
+    RUN_TEST(test_incomplete_or_oversized_slot_ignored);
+    RUN_TEST(test_pick_prefers_unused_with_fewest_erases);
+    RUN_TEST(test_pick_then_superseded_then_oldest);
+    RUN_TEST(test_pick_never_overwrites_current_copy);
+    RUN_TEST(test_writes_rotate_across_slots);
+    return UNITY_END();
+}
@@ -0,0 +1,236 @@
+#include <unity.h>
+#include <string.h>
+
+// Include implementation directly for native testing
+#include "../../src/log_ring.cpp"
+
+static LogRing ring;
+
+static bool record(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    bool ok = log_ring_vrecord(ring, 2, 1234, "main.cpp", 42, format, args);
+    va_end(args);
+    return ok;
+}
+
+static const char *pop()
+{
+    static char msg[256];
+    LogRingEntry entry;
+    if (!log_ring_pop(ring, entry, msg, sizeof(msg)))
+        return nullptr;
+    return msg;
+}
+
+void setUp(void)
+{
+    memset(&ring, 0xA5, sizeof(ring));
+    log_ring_reset(ring, 7);
+}
+
+void tearDown(void) {}
+
+void test_formats_when_popped(void)
+{
+    record("GET %s -> %d (%u bytes, %.2fV) %%done %c", "manifest.enc", 200, 4096u, 3.917, 'x');
+    TEST_ASSERT_EQUAL_STRING("GET manifest.enc -> 200 (4096 bytes, 3.92V) %done x", pop());
+    TEST_ASSERT_NULL(pop());
+}
+
+void test_entry_metadata(void)
+{
+    ring.wake = 5;
+    record("hello");
+    char msg[16];
+    LogRingEntry entry;
+    TEST_ASSERT_TRUE(log_ring_pop(ring, entry, msg, sizeof(msg)));
+    TEST_ASSERT_EQUAL(2, entry.level);
+    TEST_ASSERT_EQUAL(5, entry.wake);
+    TEST_ASSERT_EQUAL(1234, entry.time_ms);
+    TEST_ASSERT_EQUAL(42, entry.line);
+    TEST_ASSERT_EQUAL_STRING("main.cpp", entry.file);
+    TEST_ASSERT_EQUAL_STRING("hello", msg);
+}
+
+void test_length_modifiers_and_star(void)
+{
+    record("%ld %lld %zu|%-*d|%.*s %08lx", -7L, 1LL << 40, (size_t)99, 4, 3, 2, "xyz", 0xBEEFUL);
+    TEST_ASSERT_EQUAL_STRING("-7 1099511627776 99|3   |xy 0000beef", pop());
+}
+
+void test_strings_are_copied(void)
+{
+    // Callers pass stack buffers that are gone by the time the record is read
+    char buf[16];
+    strcpy(buf, "before");
+    record("url=%s", buf);
+    strcpy(buf, "after");
+    TEST_ASSERT_EQUAL_STRING("url=before", pop());
+}
+
+void test_long_string_truncated(void)
+{
+    char big[200];
+    memset(big, 'a', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    record("[%s]", big);
+    const char *msg = pop();
+    TEST_ASSERT_EQUAL(LOG_RING_MAX_STR + 2, strlen(msg));
+}
+
+void test_excess_args_print_placeholder(void)
+{
+    record("%d %d %d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+    TEST_ASSERT_EQUAL_STRING("1 2 3 4 5 6 7 8 ? ?", pop());
+}
+
+void test_overflow_drops_oldest(void)
+{
+    int n = 0;
+    while (ring.dropped == 0)
+        record("entry %d with some padding text %s", n++, "0123456789abcdef");
+    TEST_ASSERT_TRUE(log_ring_valid(ring, 7));
+
+    // What's left is the newest run, in order, ending with the last record
+    int first = (int)ring.dropped, seen = 0;
+    char expect[64];
+    const char *msg;
+    while ((msg = pop()) != nullptr)
+    {
+        snprintf(expect, sizeof(expect), "entry %d with some padding text 0123456789abcdef", first + seen);
+        TEST_ASSERT_EQUAL_STRING(expect, msg);
+        seen++;
+    }
+    TEST_ASSERT_EQUAL(n, first + seen);
+}
+
+void test_wraps_many_times(void)
+{
+    char expect[32];
+    for (int i = 0; i < 1000; i++)
+    {
+        record("n=%d", i);
+        if (i % 3 == 0)
+        {
+            const char *msg = pop();
+            TEST_ASSERT_NOT_NULL(msg);
+        }
+    }
+    TEST_ASSERT_TRUE(log_ring_valid(ring, 7));
+    const char *last = nullptr, *msg;
+    while ((msg = pop()) != nullptr)
+        last = msg;
+    snprintf(expect, sizeof(expect), "n=%d", 999);
+    TEST_ASSERT_EQUAL_STRING(expect, last);
+}
+
+void test_garbage_or_other_firmware_is_invalid(void)
+{
+    record("x=%d", 1);
+    TEST_ASSERT_TRUE(log_ring_valid(ring, 7));
+    TEST_ASSERT_FALSE(log_ring_valid(ring, 8));
+
+    ring.data[ring.head] ^= 0x40;  // record length
+    TEST_ASSERT_FALSE(log_ring_valid(ring, 7));
+
+    LogRing junk;
+    memset(&junk, 0, sizeof(junk));
+    TEST_ASSERT_FALSE(log_ring_valid(junk, 0));
+}
+
+static size_t encode(uint8_t *rec, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    size_t len = log_ring_encode(rec, 3, 99, "net.cpp", 7, format, args);
+    va_end(args);
+    return len;
+}
+
+void test_split_encode_push_take_format(void)
+{
+    // The firmware holds its lock only around push and take
+    uint8_t rec[LOG_RING_RECORD_MAX];
+    char buf[16];
+    strcpy(buf, "temp");
+    size_t len = encode(rec, "%s=%d", buf, 21);
+    strcpy(buf, "gone");
+    TEST_ASSERT_EQUAL(0, ring.used);
+
+    ring.wake = 9;
+    TEST_ASSERT_TRUE(log_ring_push(ring, rec, len));
+    memset(rec, 0, sizeof(rec));
+    TEST_ASSERT_EQUAL(len, log_ring_take(ring, rec));
+    TEST_ASSERT_EQUAL(0, log_ring_take(ring, rec));
+
+    char msg[32];
+    LogRingEntry entry;
+    log_ring_format(rec, len, entry, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL(3, entry.level);
+    TEST_ASSERT_EQUAL(9, entry.wake);
+    TEST_ASSERT_EQUAL_STRING("net.cpp", entry.file);
+    TEST_ASSERT_EQUAL_STRING("temp=21", msg);
+}
+
+void test_largest_record_fits_buffer(void)
+{
+    uint8_t rec[LOG_RING_RECORD_MAX];
+    char s[LOG_RING_MAX_STR + 10];
+    memset(s, 'a', sizeof(s) - 1);
+    s[sizeof(s) - 1] = '\0';
+    size_t len = encode(rec, "%s%s%s%s%s%s%s%s", s, s, s, s, s, s, s, s);
+    TEST_ASSERT_TRUE(len <= LOG_RING_RECORD_MAX);
+    TEST_ASSERT_TRUE(log_ring_push(ring, rec, len));
+    TEST_ASSERT_EQUAL(len, log_ring_take(ring, rec));
+}
+
+void test_damaged_record_reads_stay_in_bounds(void)
+{
+    uint8_t rec[LOG_RING_RECORD_MAX];
+    size_t len = encode(rec, "%d/%s/%d", 7, "abc", 9);
+    size_t str_at = len - sizeof(int) - 4;  // length byte of "abc"
+    char msg[32];
+    LogRingEntry entry;
+
+    log_ring_format(rec, len - sizeof(int), entry, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL_STRING("7/abc/?", msg);
+    log_ring_format(rec, str_at + 1, entry, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL_STRING("7/?/?", msg);
+
+    rec[str_at] = 200;
+    log_ring_format(rec, len, entry, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL_STRING("7/?/?", msg);
+
+    log_ring_format(rec, 3, entry, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL_STRING("", msg);
+}
+
+void test_small_output_buffer(void)
+{
+    record("%s and %d", "truncated", 12345);
+    char msg[8];
+    LogRingEntry entry;
+    TEST_ASSERT_TRUE(log_ring_pop(ring, entry, msg, sizeof(msg)));
+    TEST_ASSERT_EQUAL_STRING("truncat", msg);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_formats_when_popped);
+    RUN_TEST(test_entry_metadata);
+    RUN_TEST(test_length_modifiers_and_star);
+    RUN_TEST(test_strings_are_copied);
+    RUN_TEST(test_long_string_truncated);
+    RUN_TEST(test_excess_args_print_placeholder);
+    RUN_TEST(test_overflow_drops_oldest);
+    RUN_TEST(test_wraps_many_times);
+    RUN_TEST(test_garbage_or_other_firmware_is_invalid);
+    RUN_TEST(test_small_output_buffer);
+    RUN_TEST(test_split_encode_push_take_format);
+    RUN_TEST(test_largest_record_fits_buffer);
+    RUN_TEST(test_damaged_record_reads_stay_in_bounds);
+    return UNITY_END();
+}
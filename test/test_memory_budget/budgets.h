@@ -0,0 +1,53 @@
+#ifndef MEMORY_BUDGETS_H
+#define MEMORY_BUDGETS_H
+
+// Memory ceilings for the decrypt/parse/validate path, checked by
+// test_memory_budget. Each one is the figure measured by
+// `pio test -e native-budget` plus at most BUDGET_MARGIN_PCT. A run that needs
+// more fails. Arena bytes and allocation counts also fail when the ceiling
+// sits further above the measurement than that; heap bytes depend on the
+// host's malloc and are only capped. The test prints the line to paste here;
+// commit it with the change that moved the number and say why.
+//
+// These are native (64-bit host) figures: ArduinoJson slots, string nodes and
+// heap headers are larger than on the ESP32, so they overstate the device.
+// Treat them as regression tripwires, not as device requirements.
+
+// Rounded up, so small counts get one spare
+#define BUDGET_MARGIN_PCT 10
+
+// ---- Image: encrypted download + decrypt buffer, nothing else ----
+// Measured: two arena blocks (download, plaintext) and no heap for every
+// image in content/ and the synthetic BMP/PNG/JPEG/G5 inputs.
+#define BUDGET_IMAGE_ARENA_ALLOCS 2
+#define BUDGET_IMAGE_HEAP_ALLOCS  0
+
+// ---- Manifest: arena beyond the ciphertext + plaintext buffers ----
+// (ArduinoJson pool and strings), plus heap for the Strings kept in Manifest.
+// Corpora are described in memory_budget.test.cpp.
+// Set to 1 once the values below are the ones native-budget prints; until
+// then they are upper bounds only and the suggested values are reported.
+#define BUDGET_MANIFEST_PINNED 0
+
+#define BUDGET_MANIFEST_REAL_JSON_BYTES   12288
+#define BUDGET_MANIFEST_REAL_ARENA_ALLOCS 32
+#define BUDGET_MANIFEST_REAL_HEAP_BYTES   1024
+#define BUDGET_MANIFEST_REAL_HEAP_ALLOCS  8
+
+#define BUDGET_MANIFEST_16_JSON_BYTES     32768
+#define BUDGET_MANIFEST_16_ARENA_ALLOCS   160
+#define BUDGET_MANIFEST_16_HEAP_BYTES     6144
+#define BUDGET_MANIFEST_16_HEAP_ALLOCS    96
+
+// Extra screens are parsed into the JSON pool, then dropped
+#define BUDGET_MANIFEST_24_JSON_BYTES     36864
+#define BUDGET_MANIFEST_24_ARENA_ALLOCS   224
+#define BUDGET_MANIFEST_24_HEAP_BYTES     6144
+#define BUDGET_MANIFEST_24_HEAP_ALLOCS    96
+
+#define BUDGET_MANIFEST_LARGE_JSON_BYTES  40960
+#define BUDGET_MANIFEST_LARGE_ARENA_ALLOCS 288
+#define BUDGET_MANIFEST_LARGE_HEAP_BYTES  12288
+#define BUDGET_MANIFEST_LARGE_HEAP_ALLOCS 100
+
+#endif // MEMORY_BUDGETS_H
@@ -0,0 +1,611 @@
+#include <unity.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <dirent.h>
+
+// Include implementation directly for native testing
+#include "../../src/arena.cpp"
+#include "../../src/crypto.cpp"
+#include "../../src/image_format.cpp"
+#include "../../src/manifest.cpp"
+#include "budgets.h"
+
+// Runs the manifest and buffered-image stages of setup() (download buffer,
+// aes256_cbc_decrypt(), parse_manifest(), magic-byte validation) over real
+// and synthetic content, with every arena and heap allocation counted.
+// Caps and fault injection check that running out of memory anywhere on the
+// path fails cleanly instead of yielding a half-parsed manifest.
+
+// Logging sink for manifest.cpp; the firmware's lives in github_main.cpp
+__attribute__((weak)) void log_impl(LogLevel level, LogMode mode, const char *file, int line,
+                                    const char *format, ...)
+{
+}
+
+// ---- Heap tracking ----
+// glibc lets the program replace malloc; elsewhere only the arena is measured.
+#if defined(__GLIBC__)
+#include <malloc.h>
+#define HEAP_TRACKING 1
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t n, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+struct HeapTracker
+{
+    bool active;
+    long long current;  // usable bytes allocated since begin, minus frees
+    long long peak;
+    size_t allocs;
+    size_t cap;         // refuse allocations beyond this many live bytes (0 = none)
+    size_t fail_at;     // refuse the Nth allocation (0 = none)
+    size_t refused;
+};
+
+static HeapTracker heap;
+
+static bool heap_admit(size_t size)
+{
+    if (!heap.active)
+        return true;
+    heap.allocs++;
+    if ((heap.fail_at && heap.allocs == heap.fail_at) ||
+        (heap.cap && heap.current + (long long)size > (long long)heap.cap))
+    {
+        heap.refused++;
+        return false;
+    }
+    return true;
+}
+
+static void heap_add(long long bytes)
+{
+    if (!heap.active)
+        return;
+    heap.current += bytes;
+    if (heap.current > heap.peak)
+        heap.peak = heap.current;
+}
+
+extern "C" void *malloc(size_t size)
+{
+    if (!heap_admit(size))
+        return nullptr;
+    void *p = __libc_malloc(size);
+    if (p)
+        heap_add(malloc_usable_size(p));
+    return p;
+}
+
+extern "C" void *calloc(size_t n, size_t size)
+{
+    if (!heap_admit(n * size))
+        return nullptr;
+    void *p = __libc_calloc(n, size);
+    if (p)
+        heap_add(malloc_usable_size(p));
+    return p;
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    if (!ptr)
+        return malloc(size);
+    if (size == 0)
+    {
+        free(ptr);
+        return nullptr;
+    }
+    if (!heap_admit(size))
+        return nullptr;
+    long long before = malloc_usable_size(ptr);
+    void *p = __libc_realloc(ptr, size);
+    if (p)
+        heap_add((long long)malloc_usable_size(p) - before);
+    return p;
+}
+
+extern "C" void free(void *ptr)
+{
+    if (ptr)
+        heap_add(-(long long)malloc_usable_size(ptr));
+    __libc_free(ptr);
+}
+#else
+#define HEAP_TRACKING 0
+
+struct HeapTracker
+{
+    bool active;
+    long long current, peak;
+    size_t allocs, cap, fail_at, refused;
+};
+
+static HeapTracker heap;
+#endif
+
+static void heap_begin(size_t cap, size_t fail_at)
+{
+    memset(&heap, 0, sizeof(heap));
+    heap.cap = cap;
+    heap.fail_at = fail_at;
+    heap.active = true;
+}
+
+static void heap_end()
+{
+    heap.active = false;
+}
+
+// ---- Corpora ----
+
+struct Blob
+{
+    uint8_t *data;
+    size_t size;
+};
+
+static const uint8_t content_key[AES256_KEY_SIZE] = {0};  // content/ is encrypted with an all-zero key
+static uint8_t test_key[AES256_KEY_SIZE];
+
+#define ARENA_BLOCK_SIZE (1024 * 1024)
+static uint8_t *arena_block;
+
+static const char *content_dir()
+{
+    // pio test runs from the project directory; also allow running from test/
+    static const char *candidates[] = {"content", "../content", "../../content"};
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++)
+    {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/manifest.enc", candidates[i]);
+        FILE *f = fopen(path, "rb");
+        if (f)
+        {
+            fclose(f);
+            return candidates[i];
+        }
+    }
+    return nullptr;
+}
+
+static Blob read_blob(const char *path)
+{
+    Blob b = {nullptr, 0};
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return b;
+    fseek(f, 0, SEEK_END);
+    b.size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    b.data = (uint8_t *)malloc(b.size ? b.size : 1);
+    if (fread(b.data, 1, b.size, f) != b.size)
+        b.size = 0;
+    fclose(f);
+    return b;
+}
+
+static Blob encrypt_blob(const uint8_t *plain, size_t len)
+{
+    uint8_t iv[AES_IV_SIZE];
+    for (size_t i = 0; i < sizeof(iv); i++)
+        iv[i] = (uint8_t)(i * 37 + len);
+    Blob b;
+    b.data = (uint8_t *)malloc(aes256_cbc_encrypted_size(len));
+    TEST_ASSERT_TRUE(aes256_cbc_encrypt(test_key, iv, plain, len, b.data, &b.size));
+    return b;
+}
+
+// Manifest JSON as update_manifest.py writes it
+static Blob make_manifest(int screens, int name_len, int mirrors)
+{
+    size_t cap = 4096 + (size_t)screens * (400 + 2 * name_len) + (size_t)mirrors * 128;
+    char *json = (char *)malloc(cap);
+    size_t n = snprintf(json, cap, "{\n  \"version\": 1,\n  \"refresh_rate\": 1800,\n"
+                                   "  \"updated_at\": \"2026-10-18T06:00:00.000000+00:00\",\n");
+    if (mirrors)
+    {
+        n += snprintf(json + n, cap - n, "  \"mirrors\": [");
+        for (int i = 0; i < mirrors; i++)
+            n += snprintf(json + n, cap - n, "%s\n    \"https://mirror%d.example.net/user/content@main/images/\"",
+                          i ? "," : "", i);
+        n += snprintf(json + n, cap - n, "\n  ],\n");
+    }
+    n += snprintf(json + n, cap - n, "  \"screens\": [");
+
+    char name[512];
+    for (int i = 0; i < screens; i++)
+    {
+        int len = snprintf(name, sizeof(name), "screen_%02d", i);
+        for (; len < name_len && len < (int)sizeof(name) - 1; len++)
+            name[len] = (char)('a' + (len + i) % 26);
+        name[len] = '\0';
+        n += snprintf(json + n, cap - n,
+                      "%s\n    {\n      \"name\": \"%s\",\n      \"filename\": \"%s.enc\",\n"
+                      "      \"size\": %d,\n      \"format\": \"%s\",\n      \"hash\": \"%016llx\",\n"
+                      "      \"delta\": {\n        \"filename\": \"%s.dlt\",\n        \"size\": %d,\n"
+                      "        \"base\": \"%016llx\"\n      }\n    }",
+                      i ? "," : "", name, name, 48080 + i, i % 2 ? "png" : "bmp",
+                      0x0123456789abcdefULL * (i + 1), name, 320 + i, 0xfedcba9876543210ULL ^ (unsigned long long)i);
+    }
+    n += snprintf(json + n, cap - n, "\n  ]\n}");
+    TEST_ASSERT_TRUE(n < cap);
+
+    Blob b = encrypt_blob((const uint8_t *)json, n);
+    free(json);
+    return b;
+}
+
+static void free_blob(Blob &b)
+{
+    free(b.data);
+    b.data = nullptr;
+}
+
+// ---- Measured runs ----
+
+struct Usage
+{
+    bool ok;
+    size_t arena_peak;
+    size_t arena_allocs;
+    size_t heap_peak;
+    size_t heap_allocs;
+};
+
+// The manifest stage of setup(): download into the arena, decrypt next to
+// it, parse with the JSON pool in the arena, keep the screens
+static Usage run_manifest(const Blob &enc, const uint8_t *key, size_t arena_cap, size_t heap_fail_at,
+                          Manifest *keep = nullptr)
+{
+    Usage u = {};
+    Arena arena;
+    arena_init(arena, arena_block, arena_cap);
+    heap_begin(0, heap_fail_at);
+    {
+        Manifest manifest;
+        size_t mark = arena_mark(arena);
+        uint8_t *download = (uint8_t *)arena_alloc(arena, enc.size);
+        uint8_t *plain = download ? (uint8_t *)arena_alloc(arena, enc.size) : nullptr;
+        size_t plain_size = 0;
+        if (plain)
+        {
+            memcpy(download, enc.data, enc.size);
+            u.ok = aes256_cbc_decrypt(key, download, enc.size, plain, &plain_size) &&
+                   parse_manifest(plain, plain_size, manifest, &arena);
+        }
+        arena_rewind(arena, mark);
+        u.heap_peak = (size_t)heap.peak;
+        u.heap_allocs = heap.allocs;
+        if (keep && u.ok)
+        {
+            heap_end();
+            *keep = manifest;
+        }
+    }
+    heap_end();
+    u.arena_peak = arena.high_water;
+    u.arena_allocs = arena.allocs;
+    return u;
+}
+
+// The buffered image stage: download, decrypt, then the format checks
+static Usage run_image(const Blob &enc, const uint8_t *key, ImageFormat expected, size_t arena_cap)
+{
+    Usage u = {};
+    Arena arena;
+    arena_init(arena, arena_block, arena_cap);
+    heap_begin(0, 0);
+    uint8_t *download = (uint8_t *)arena_alloc(arena, enc.size);
+    uint8_t *plain = download ? (uint8_t *)arena_alloc(arena, enc.size) : nullptr;
+    size_t plain_size = 0;
+    if (plain)
+    {
+        memcpy(download, enc.data, enc.size);
+        ImageFormat format = IMAGE_FORMAT_UNKNOWN;
+        u.ok = aes256_cbc_decrypt(key, download, enc.size, plain, &plain_size) &&
+               (format = detect_image_format(plain, plain_size)) != IMAGE_FORMAT_UNKNOWN &&
+               (expected == IMAGE_FORMAT_UNKNOWN || format == expected) &&
+               (format != IMAGE_FORMAT_G5 || g5_header_valid(plain, plain_size));
+    }
+    heap_end();
+    u.arena_peak = arena.high_water;
+    u.arena_allocs = arena.allocs;
+    u.heap_peak = (size_t)heap.peak;
+    u.heap_allocs = heap.allocs;
+    return u;
+}
+
+static size_t round_up(size_t n)
+{
+    return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static void report(const char *path, const Blob &enc, const Usage &u)
+{
+    char line[200];
+    snprintf(line, sizeof(line), "%-22s %7zu B in | arena peak %7zu B, %4zu allocs | heap peak %6zu B, %4zu allocs%s",
+             path, enc.size, u.arena_peak, u.arena_allocs, u.heap_peak, u.heap_allocs,
+             HEAP_TRACKING ? "" : " (heap not tracked)");
+    TEST_MESSAGE(line);
+}
+
+// Highest ceiling still considered pinned to a measurement
+static size_t budget_limit(size_t measured)
+{
+    return measured + (measured * BUDGET_MARGIN_PCT + 99) / 100;
+}
+
+// Over the ceiling is a regression. With two_sided, a ceiling more than the
+// margin above the measurement also fails, since it no longer tracks the
+// code; otherwise that is only reported. Either way it prints the budgets.h
+// line to paste.
+static bool check_budget(const char *path, const char *prefix, const char *what, size_t measured, size_t ceiling,
+                         bool two_sided)
+{
+    bool over = measured > ceiling;
+    bool loose = ceiling > budget_limit(measured);
+    if (!over && !loose)
+        return true;
+    char line[200];
+    snprintf(line, sizeof(line), "%s: measured %zu, ceiling %zu -> #define BUDGET_%s_%s %zu%s", path, measured,
+             ceiling, prefix, what, budget_limit(measured), over || two_sided ? "" : " (not enforced)");
+    TEST_MESSAGE(line);
+    return !over && !two_sided;
+}
+
+static void check_manifest_budget(const char *path, const Blob &enc, const uint8_t *key, int expect_screens,
+                                  const char *prefix, size_t json_bytes, size_t arena_allocs, size_t heap_bytes,
+                                  size_t heap_allocs)
+{
+    Manifest m;
+    Usage u = run_manifest(enc, key, ARENA_BLOCK_SIZE, 0, &m);
+    report(path, enc, u);
+    TEST_ASSERT_TRUE(u.ok);
+    TEST_ASSERT_EQUAL(expect_screens, m.screen_count);
+
+    // Heap bytes are malloc_usable_size() figures, which vary with the libc
+    // and architecture, so they are only capped
+    bool pinned = BUDGET_MANIFEST_PINNED;
+    bool within = check_budget(path, prefix, "JSON_BYTES", u.arena_peak - 2 * round_up(enc.size), json_bytes,
+                               pinned);
+    within = check_budget(path, prefix, "ARENA_ALLOCS", u.arena_allocs, arena_allocs, pinned) && within;
+    if (HEAP_TRACKING)
+    {
+        within = check_budget(path, prefix, "HEAP_BYTES", u.heap_peak, heap_bytes, false) && within;
+        within = check_budget(path, prefix, "HEAP_ALLOCS", u.heap_allocs, heap_allocs, pinned) && within;
+    }
+    if (!within)
+        TEST_FAIL_MESSAGE("memory budget off, see the budgets.h lines above");
+}
+
+static void check_image_budget(const char *path, const Blob &enc, const uint8_t *key, ImageFormat expected)
+{
+    Usage u = run_image(enc, key, expected, ARENA_BLOCK_SIZE);
+    report(path, enc, u);
+    TEST_ASSERT_TRUE(u.ok);
+    TEST_ASSERT_EQUAL(2 * round_up(enc.size), u.arena_peak);
+    bool within = check_budget(path, "IMAGE", "ARENA_ALLOCS", u.arena_allocs, BUDGET_IMAGE_ARENA_ALLOCS, true);
+    if (HEAP_TRACKING)
+        within = check_budget(path, "IMAGE", "HEAP_ALLOCS", u.heap_allocs, BUDGET_IMAGE_HEAP_ALLOCS, true) && within;
+    if (!within)
+        TEST_FAIL_MESSAGE("memory budget off, see the budgets.h lines above");
+}
+
+static bool same_manifest(const Manifest &a, const Manifest &b)
+{
+    if (a.screen_count != b.screen_count || a.mirror_count != b.mirror_count || a.updated_at != b.updated_at)
+        return false;
+    for (int i = 0; i < a.mirror_count; i++)
+        if (a.mirrors[i] != b.mirrors[i])
+            return false;
+    for (int i = 0; i < a.screen_count; i++)
+    {
+        const ManifestScreen &x = a.screens[i], &y = b.screens[i];
+        if (x.name != y.name || x.filename != y.filename || x.hash != y.hash ||
+            x.delta_filename != y.delta_filename || x.delta_base != y.delta_base ||
+            x.size != y.size || x.format != y.format || x.delta_size != y.delta_size)
+            return false;
+    }
+    return true;
+}
+
+// ---- Tests ----
+
+void setUp(void)
+{
+    for (size_t i = 0; i < sizeof(test_key); i++)
+        test_key[i] = (uint8_t)(0xA0 + i);
+    if (!arena_block)
+        arena_block = (uint8_t *)malloc(ARENA_BLOCK_SIZE);
+}
+
+void tearDown(void)
+{
+    heap_end();
+}
+
+void test_real_content_manifest(void)
+{
+    const char *dir = content_dir();
+    if (!dir)
+        TEST_IGNORE_MESSAGE("content/ not found");
+    char path[256];
+    snprintf(path, sizeof(path), "%s/manifest.enc", dir);
+    Blob enc = read_blob(path);
+    TEST_ASSERT_GREATER_THAN(0, enc.size);
+    check_manifest_budget("content/manifest.enc", enc, content_key, 1, "MANIFEST_REAL",
+                          BUDGET_MANIFEST_REAL_JSON_BYTES, BUDGET_MANIFEST_REAL_ARENA_ALLOCS,
+                          BUDGET_MANIFEST_REAL_HEAP_BYTES, BUDGET_MANIFEST_REAL_HEAP_ALLOCS);
+    free_blob(enc);
+}
+
+void test_real_content_images(void)
+{
+    const char *dir = content_dir();
+    if (!dir)
+        TEST_IGNORE_MESSAGE("content/ not found");
+    char images[256];
+    snprintf(images, sizeof(images), "%s/images", dir);
+    DIR *d = opendir(images);
+    TEST_ASSERT_NOT_NULL(d);
+
+    int checked = 0;
+    struct dirent *e;
+    while ((e = readdir(d)) != nullptr)
+    {
+        size_t len = strlen(e->d_name);
+        if (len < 5 || strcmp(e->d_name + len - 4, ".enc") != 0)
+            continue;
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", images, e->d_name);
+        Blob enc = read_blob(path);
+        check_image_budget(e->d_name, enc, content_key, IMAGE_FORMAT_UNKNOWN);
+        free_blob(enc);
+        checked++;
+    }
+    closedir(d);
+    TEST_ASSERT_GREATER_THAN(0, checked);
+}
+
+void test_synthetic_images(void)
+{
+    // Largest of each kind the panel takes: 800x480 1-bpp BMP, big PNG/JPEG, G5
+    static uint8_t plain[200 * 1024];
+    memset(plain, 0x5A, sizeof(plain));
+
+    memcpy(plain, "BM", 2);
+    Blob bmp = encrypt_blob(plain, 62 + 800 * 480 / 8);
+    check_image_budget("800x480 BMP", bmp, test_key, IMAGE_FORMAT_BMP);
+
+    const uint8_t png_magic[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    memcpy(plain, png_magic, sizeof(png_magic));
+    Blob png = encrypt_blob(plain, sizeof(plain));
+    check_image_budget("200 KB PNG", png, test_key, IMAGE_FORMAT_PNG);
+
+    plain[0] = 0xFF;
+    plain[1] = 0xD8;
+    Blob jpeg = encrypt_blob(plain, 120 * 1024);
+    check_image_budget("120 KB JPEG", jpeg, test_key, IMAGE_FORMAT_JPEG);
+
+    const uint8_t g5_header[] = {0xBF, 0xBB, 0x20, 0x03, 0xE0, 0x01, 0x00, 0x90};  // 800x480, 36864 B
+    memcpy(plain, g5_header, sizeof(g5_header));
+    Blob g5 = encrypt_blob(plain, G5_HEADER_SIZE + 0x9000);
+    check_image_budget("800x480 G5", g5, test_key, IMAGE_FORMAT_G5);
+
+    free_blob(bmp);
+    free_blob(png);
+    free_blob(jpeg);
+    free_blob(g5);
+}
+
+void test_manifest_16_screens(void)
+{
+    Blob enc = make_manifest(MANIFEST_MAX_SCREENS, 0, 0);
+    check_manifest_budget("16 screens", enc, test_key, MANIFEST_MAX_SCREENS, "MANIFEST_16",
+                          BUDGET_MANIFEST_16_JSON_BYTES, BUDGET_MANIFEST_16_ARENA_ALLOCS,
+                          BUDGET_MANIFEST_16_HEAP_BYTES, BUDGET_MANIFEST_16_HEAP_ALLOCS);
+    free_blob(enc);
+}
+
+void test_manifest_more_than_16_screens(void)
+{
+    Blob enc = make_manifest(24, 0, 0);
+    check_manifest_budget("24 screens", enc, test_key, MANIFEST_MAX_SCREENS, "MANIFEST_24",
+                          BUDGET_MANIFEST_24_JSON_BYTES, BUDGET_MANIFEST_24_ARENA_ALLOCS,
+                          BUDGET_MANIFEST_24_HEAP_BYTES, BUDGET_MANIFEST_24_HEAP_ALLOCS);
+    free_blob(enc);
+}
+
+void test_manifest_large(void)
+{
+    // Long screen names and filenames, every optional field, all mirrors
+    Blob enc = make_manifest(MANIFEST_MAX_SCREENS, 120, MANIFEST_MAX_MIRRORS);
+    check_manifest_budget("16 screens, long names", enc, test_key, MANIFEST_MAX_SCREENS, "MANIFEST_LARGE",
+                          BUDGET_MANIFEST_LARGE_JSON_BYTES, BUDGET_MANIFEST_LARGE_ARENA_ALLOCS,
+                          BUDGET_MANIFEST_LARGE_HEAP_BYTES, BUDGET_MANIFEST_LARGE_HEAP_ALLOCS);
+    free_blob(enc);
+}
+
+void test_manifest_fails_cleanly_under_every_arena_cap(void)
+{
+    // A bump arena needs exactly its high-water mark; any smaller cap must
+    // make some allocation fail, and that must surface as a parse failure
+    Blob enc = make_manifest(MANIFEST_MAX_SCREENS, 40, 2);
+    Usage full = run_manifest(enc, test_key, ARENA_BLOCK_SIZE, 0);
+    TEST_ASSERT_TRUE(full.ok);
+
+    for (size_t cap = 0; cap < full.arena_peak; cap += ARENA_ALIGN)
+    {
+        Usage u = run_manifest(enc, test_key, cap, 0);
+        if (u.ok)
+        {
+            char msg[80];
+            snprintf(msg, sizeof(msg), "parsed with a %zu B arena, peak is %zu B", cap, full.arena_peak);
+            TEST_FAIL_MESSAGE(msg);
+        }
+    }
+    TEST_ASSERT_TRUE(run_manifest(enc, test_key, full.arena_peak, 0).ok);
+    free_blob(enc);
+}
+
+void test_image_fails_cleanly_under_arena_cap(void)
+{
+    static uint8_t plain[62 + 800 * 480 / 8];
+    memset(plain, 0, sizeof(plain));
+    memcpy(plain, "BM", 2);
+    Blob enc = encrypt_blob(plain, sizeof(plain));
+
+    size_t need = 2 * round_up(enc.size);
+    TEST_ASSERT_FALSE(run_image(enc, test_key, IMAGE_FORMAT_BMP, 0).ok);
+    TEST_ASSERT_FALSE(run_image(enc, test_key, IMAGE_FORMAT_BMP, round_up(enc.size)).ok);
+    TEST_ASSERT_FALSE(run_image(enc, test_key, IMAGE_FORMAT_BMP, need - ARENA_ALIGN).ok);
+    TEST_ASSERT_TRUE(run_image(enc, test_key, IMAGE_FORMAT_BMP, need).ok);
+    free_blob(enc);
+}
+
+void test_manifest_survives_every_heap_failure(void)
+{
+#if HEAP_TRACKING
+    // Fail each heap allocation of the parse in turn: the result must be a
+    // parse failure or the complete manifest, never one with missing strings
+    Blob enc = make_manifest(MANIFEST_MAX_SCREENS, 40, 2);
+    Manifest expected;
+    Usage full = run_manifest(enc, test_key, ARENA_BLOCK_SIZE, 0, &expected);
+    TEST_ASSERT_TRUE(full.ok);
+    TEST_ASSERT_GREATER_THAN(0, full.heap_allocs);
+
+    for (size_t k = 1; k <= full.heap_allocs; k++)
+    {
+        Manifest got;
+        Usage u = run_manifest(enc, test_key, ARENA_BLOCK_SIZE, k, &got);
+        if (u.ok && !same_manifest(expected, got))
+        {
+            char msg[80];
+            snprintf(msg, sizeof(msg), "heap failure at allocation %zu gave a partial manifest", k);
+            TEST_FAIL_MESSAGE(msg);
+        }
+    }
+    free_blob(enc);
+#else
+    TEST_IGNORE_MESSAGE("heap tracking needs glibc");
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_real_content_manifest);
+    RUN_TEST(test_real_content_images);
+    RUN_TEST(test_synthetic_images);
+    RUN_TEST(test_manifest_16_screens);
+    RUN_TEST(test_manifest_more_than_16_screens);
+    RUN_TEST(test_manifest_large);
+    RUN_TEST(test_manifest_fails_cleanly_under_every_arena_cap);
+    RUN_TEST(test_image_fails_cleanly_under_arena_cap);
+    RUN_TEST(test_manifest_survives_every_heap_failure);
+    return UNITY_END();
+}
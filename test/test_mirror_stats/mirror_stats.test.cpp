@@ -0,0 +1,160 @@
+#include <unity.h>
+#include <string.h>
+
+// Include implementation directly for native testing (no RTC or network)
+#include "../../src/mirror_stats.cpp"
+
+static MirrorStats stats;
+static uint32_t keys[3];
+
+static void rank(int *order)
+{
+    mirror_rank(stats, keys, 3, order);
+}
+
+void setUp(void)
+{
+    memset(&stats, 0xA5, sizeof(stats));
+    mirror_stats_reset(stats);
+    keys[0] = mirror_origin_key("https://user.github.io/content/manifest.enc");
+    keys[1] = mirror_origin_key("https://cdn.jsdelivr.net/gh/user/content@main/manifest.enc");
+    keys[2] = mirror_origin_key("https://raw.githubusercontent.com/user/content/main/manifest.enc");
+}
+
+void tearDown(void) {}
+
+void test_key_is_per_host(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(mirror_origin_key("https://user.github.io/content/manifest.enc"),
+                             mirror_origin_key("https://USER.github.io/content/images/a.enc"));
+    TEST_ASSERT_EQUAL_UINT32(mirror_origin_key("https://user.github.io"),
+                             mirror_origin_key("https://user.github.io/x"));
+    TEST_ASSERT_TRUE(keys[0] != keys[1] && keys[1] != keys[2]);
+}
+
+void test_unmeasured_keeps_config_order(void)
+{
+    int order[3];
+    rank(order);
+    TEST_ASSERT_EQUAL(0, order[0]);
+    TEST_ASSERT_EQUAL(1, order[1]);
+    TEST_ASSERT_EQUAL(2, order[2]);
+}
+
+void test_fastest_first_after_measuring(void)
+{
+    mirror_stats_record(stats, keys[0], true, 900);
+    mirror_stats_record(stats, keys[1], true, 250);
+    mirror_stats_record(stats, keys[2], true, 600);
+    int order[3];
+    rank(order);
+    TEST_ASSERT_EQUAL(1, order[0]);
+    TEST_ASSERT_EQUAL(2, order[1]);
+    TEST_ASSERT_EQUAL(0, order[2]);
+}
+
+void test_unmeasured_tried_before_measured(void)
+{
+    // A new mirror gets timed once instead of waiting for the primary to fail
+    mirror_stats_record(stats, keys[0], true, 300);
+    int order[3];
+    rank(order);
+    TEST_ASSERT_EQUAL(1, order[0]);
+    TEST_ASSERT_EQUAL(2, order[1]);
+    TEST_ASSERT_EQUAL(0, order[2]);
+}
+
+void test_failed_origin_moves_back_then_recovers(void)
+{
+    mirror_stats_record(stats, keys[0], true, 100);
+    mirror_stats_record(stats, keys[1], true, 800);
+    mirror_stats_record(stats, keys[2], true, 900);
+    mirror_stats_record(stats, keys[0], false, 0);
+
+    int order[3];
+    rank(order);
+    TEST_ASSERT_EQUAL(0, order[2]);
+
+    // penalty 2 after the first failure
+    mirror_stats_tick(stats);
+    rank(order);
+    TEST_ASSERT_EQUAL(0, order[2]);
+    mirror_stats_tick(stats);
+    rank(order);
+    TEST_ASSERT_EQUAL(0, order[0]);
+}
+
+void test_penalty_doubles_and_caps(void)
+{
+    for (int i = 0; i < 10; i++)
+        mirror_stats_record(stats, keys[1], false, 0);
+    const MirrorStat *e = mirror_stats_find(stats, keys[1]);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL(1 << MIRROR_PENALTY_MAX_SHIFT, e->penalty);
+
+    mirror_stats_record(stats, keys[1], true, 500);
+    TEST_ASSERT_EQUAL(0, e->penalty);
+    TEST_ASSERT_EQUAL(0, e->failures);
+}
+
+void test_latency_smoothed(void)
+{
+    mirror_stats_record(stats, keys[0], true, 400);
+    mirror_stats_record(stats, keys[0], true, 4000);
+    TEST_ASSERT_EQUAL(1300, mirror_stats_find(stats, keys[0])->latency_ms);
+}
+
+void test_timeouts(void)
+{
+    // Unknown origin with a fallback: early abort at the cap
+    TEST_ASSERT_EQUAL(MIRROR_MAX_TIMEOUT_MS, mirror_timeout_ms(stats, keys[0], false));
+    // Last origin always gets the normal timeout
+    TEST_ASSERT_EQUAL(0, mirror_timeout_ms(stats, keys[0], true));
+
+    mirror_stats_record(stats, keys[0], true, 200);
+    TEST_ASSERT_EQUAL(MIRROR_MIN_TIMEOUT_MS, mirror_timeout_ms(stats, keys[0], false));
+    mirror_stats_record(stats, keys[1], true, 1200);
+    TEST_ASSERT_EQUAL(1200 * MIRROR_TIMEOUT_FACTOR, mirror_timeout_ms(stats, keys[1], false));
+}
+
+void test_evicts_longest_unused(void)
+{
+    char url[64];
+    for (int i = 0; i < MIRROR_STATS_SLOTS; i++)
+    {
+        snprintf(url, sizeof(url), "https://mirror%d.example", i);
+        mirror_stats_record(stats, mirror_origin_key(url), true, 100 + i);
+        mirror_stats_tick(stats);
+    }
+    uint32_t fresh = mirror_origin_key("https://new.example");
+    mirror_stats_record(stats, fresh, true, 50);
+    TEST_ASSERT_NOT_NULL(mirror_stats_find(stats, fresh));
+    TEST_ASSERT_NULL(mirror_stats_find(stats, mirror_origin_key("https://mirror0.example")));
+    TEST_ASSERT_NOT_NULL(mirror_stats_find(stats, mirror_origin_key("https://mirror1.example")));
+}
+
+void test_seal_and_corruption(void)
+{
+    mirror_stats_record(stats, keys[0], true, 300);
+    TEST_ASSERT_FALSE(mirror_stats_valid(stats));
+    mirror_stats_seal(stats);
+    TEST_ASSERT_TRUE(mirror_stats_valid(stats));
+    ((uint8_t *)&stats)[9] ^= 1;
+    TEST_ASSERT_FALSE(mirror_stats_valid(stats));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_key_is_per_host);
+    RUN_TEST(test_unmeasured_keeps_config_order);
+    RUN_TEST(test_fastest_first_after_measuring);
+    RUN_TEST(test_unmeasured_tried_before_measured);
+    RUN_TEST(test_failed_origin_moves_back_then_recovers);
+    RUN_TEST(test_penalty_doubles_and_caps);
+    RUN_TEST(test_latency_smoothed);
+    RUN_TEST(test_timeouts);
+    RUN_TEST(test_evicts_longest_unused);
+    RUN_TEST(test_seal_and_corruption);
+    return UNITY_END();
+}
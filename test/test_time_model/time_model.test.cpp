@@ -0,0 +1,110 @@
+#include <unity.h>
+#include <string.h>
+
+// Include implementation directly for native testing (model only)
+#include "../../src/time_model.cpp"
+
+#define S 1000000LL  // one second in microseconds
+#define EPOCH (1760000000LL * S)
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// One wake of awake_s followed by sleep_s of RTC time, with the RTC clock
+// running drift_ppm slow (true time passes faster than it counts)
+static int64_t simulate_wake(TimeModel &m, int64_t true_now, int awake_s, int sleep_s, int drift_ppm)
+{
+    time_model_advance(m, (int64_t)awake_s * S, (int64_t)sleep_s * S);
+    return true_now + (int64_t)awake_s * S + (int64_t)sleep_s * S + (int64_t)sleep_s * drift_ppm;
+}
+
+void test_fresh_model_needs_sync(void)
+{
+    TimeModel m;
+    time_model_reset(m);
+    TEST_ASSERT_TRUE(time_model_valid(m));
+    TEST_ASSERT_TRUE(time_model_needs_sync(m, 0));
+}
+
+void test_corrupt_model_is_invalid(void)
+{
+    TimeModel m;
+    time_model_reset(m);
+    time_model_sync(m, EPOCH, 0);
+    m.sleep_us += 1;
+    TEST_ASSERT_FALSE(time_model_valid(m));
+}
+
+void test_estimate_counts_awake_and_sleep(void)
+{
+    TimeModel m;
+    time_model_reset(m);
+    time_model_sync(m, EPOCH + 2 * S, 2 * S);  // synced 2 s into the wake
+    time_model_advance(m, 10 * S, 900 * S);
+    TEST_ASSERT_TRUE(time_model_now_us(m, 3 * S) == EPOCH + 910 * S + 3 * S);
+}
+
+void test_learns_drift_and_stops_syncing_every_wake(void)
+{
+    const int drift = 20000;  // 2% slow RC clock
+    TimeModel m;
+    time_model_reset(m);
+    int64_t truth = EPOCH;
+    time_model_sync(m, truth, 0);
+
+    // Unlearned: 900 s at ±5% is far over the threshold
+    truth = simulate_wake(m, truth, 10, 900, drift);
+    TEST_ASSERT_TRUE(time_model_needs_sync(m, 0));
+    time_model_sync(m, truth, 0);
+    TEST_ASSERT_INT_WITHIN(10, drift, m.drift_ppm);
+
+    // One more short cycle to confirm the rate
+    truth = simulate_wake(m, truth, 10, 900, drift);
+    time_model_sync(m, truth, 0);
+    TEST_ASSERT_EQUAL(TIME_DRIFT_FLOOR_PPM, m.drift_uncertainty_ppm);
+
+    // Now the model carries the clock for hours, and stays accurate
+    int wakes = 0;
+    while (!time_model_needs_sync(m, 0) && wakes < 200)
+    {
+        truth = simulate_wake(m, truth, 10, 900, drift);
+        wakes++;
+    }
+    TEST_ASSERT_TRUE(wakes > 20);
+    int64_t off = time_model_now_us(m, 0) - truth;
+    TEST_ASSERT_TRUE(off > -2 * S && off < 2 * S);
+}
+
+void test_daily_sync_even_when_accurate(void)
+{
+    TimeModel m;
+    time_model_reset(m);
+    time_model_sync(m, EPOCH, 0);
+    m.drift_uncertainty_ppm = 0;  // pretend the clock is perfect
+    time_model_advance(m, 0, (int64_t)TIME_MAX_SYNC_AGE_S * S);
+    TEST_ASSERT_TRUE(time_model_needs_sync(m, 0));
+}
+
+void test_absurd_measurement_not_learned(void)
+{
+    // A lost sleep (e.g. accounting reset) must not poison the drift
+    TimeModel m;
+    time_model_reset(m);
+    time_model_sync(m, EPOCH, 0);
+    time_model_advance(m, 0, 3600 * S);
+    time_model_sync(m, EPOCH + 3 * 3600 * S, 0);
+    TEST_ASSERT_EQUAL(0, m.samples);
+    TEST_ASSERT_EQUAL(0, m.drift_ppm);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_fresh_model_needs_sync);
+    RUN_TEST(test_corrupt_model_is_invalid);
+    RUN_TEST(test_estimate_counts_awake_and_sleep);
+    RUN_TEST(test_learns_drift_and_stops_syncing_every_wake);
+    RUN_TEST(test_daily_sync_even_when_accurate);
+    RUN_TEST(test_absurd_measurement_not_learned);
+    return UNITY_END();
+}
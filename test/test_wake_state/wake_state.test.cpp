@@ -0,0 +1,87 @@
+#include <unity.h>
+#include <string.h>
+
+// Include implementation directly for native testing (record logic only)
+#include "../../src/wake_state_record.cpp"
+
+static WakeState make_state()
+{
+    WakeState s;
+    memset(&s, 0, sizeof(s));
+    s.wifi_retry = s.nvs_wifi_retry = 1;
+    s.api_retry = s.nvs_api_retry = 1;
+    s.sleep_time = s.nvs_sleep_time = 900;
+    s.config_cached = 1;
+    strcpy(s.manifest_url, "https://example.github.io/content/manifest.enc");
+    wake_state_seal(s);
+    return s;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_zeroed_rtc_is_invalid(void)
+{
+    WakeState s;
+    memset(&s, 0, sizeof(s));
+    TEST_ASSERT_FALSE(wake_state_valid(s));
+}
+
+void test_sealed_state_is_valid(void)
+{
+    WakeState s = make_state();
+    TEST_ASSERT_TRUE(wake_state_valid(s));
+    TEST_ASSERT_EQUAL(sizeof(WakeState), s.size);
+}
+
+void test_any_corruption_is_detected(void)
+{
+    WakeState s = make_state();
+    for (size_t i = 0; i < offsetof(WakeState, checksum); i += 7)
+    {
+        WakeState copy = s;
+        ((uint8_t *)&copy)[i] ^= 0x10;
+        TEST_ASSERT_FALSE(wake_state_valid(copy));
+    }
+}
+
+void test_change_without_seal_is_invalid(void)
+{
+    // A reset in the middle of a wake must fall back to NVS, not half-updated RTC
+    WakeState s = make_state();
+    s.api_retry = 3;
+    TEST_ASSERT_FALSE(wake_state_valid(s));
+    wake_state_seal(s);
+    TEST_ASSERT_TRUE(wake_state_valid(s));
+}
+
+void test_dirty_only_for_changed_fields(void)
+{
+    WakeState s = make_state();
+    TEST_ASSERT_EQUAL(0, wake_state_dirty(s));
+
+    s.api_retry = 2;
+    TEST_ASSERT_EQUAL(WAKE_DIRTY_API_RETRY, wake_state_dirty(s));
+
+    s.sleep_time = 15;
+    TEST_ASSERT_EQUAL(WAKE_DIRTY_API_RETRY | WAKE_DIRTY_SLEEP_TIME, wake_state_dirty(s));
+
+    // Back to what NVS holds — nothing to write
+    s.api_retry = 1;
+    s.sleep_time = 900;
+    TEST_ASSERT_EQUAL(0, wake_state_dirty(s));
+
+    s.wifi_retry = 4;
+    TEST_ASSERT_EQUAL(WAKE_DIRTY_WIFI_RETRY, wake_state_dirty(s));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_zeroed_rtc_is_invalid);
+    RUN_TEST(test_sealed_state_is_valid);
+    RUN_TEST(test_any_corruption_is_detected);
+    RUN_TEST(test_change_without_seal_is_invalid);
+    RUN_TEST(test_dirty_only_for_changed_fields);
+    return UNITY_END();
+}
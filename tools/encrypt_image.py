@@ -3,12 +3,21 @@
 
 Wire format: [16-byte IV][ciphertext with PKCS7 padding]
 
+With --deterministic the IV is HMAC-SHA256(key, "iv" || plaintext) truncated to
+16 bytes instead of random, so the same input always encrypts to the same file,
+and an output that already holds the same plaintext is left untouched. An
+observer can then tell that two files are equal, nothing more — which the
+manifest's frame hashes already reveal.
+
 Usage:
     python encrypt_image.py --key <hex> --input <file> --output <file>
+    python encrypt_image.py --key <hex> --input <file> --output <file> --deterministic
     python encrypt_image.py --key <hex> --input <file> --output <file> --decrypt
 """
 
 import argparse
+import hashlib
+import hmac
 import os
 import sys
 
@@ -24,8 +33,14 @@ except ImportError:
         sys.exit(1)
 
 
-def encrypt(key: bytes, plaintext: bytes) -> bytes:
-    iv = os.urandom(16)
+def deterministic_iv(key: bytes, plaintext: bytes) -> bytes:
+    # The AES key never keys the HMAC directly; tools/pack_content.cpp matches this
+    iv_key = hmac.new(key, b"trmnl-iv", hashlib.sha256).digest()
+    return hmac.new(iv_key, plaintext, hashlib.sha256).digest()[:16]
+
+
+def encrypt(key: bytes, plaintext: bytes, deterministic: bool = False) -> bytes:
+    iv = deterministic_iv(key, plaintext) if deterministic else os.urandom(16)
     cipher = AES.new(key, AES.MODE_CBC, iv)
     ciphertext = cipher.encrypt(pad(plaintext, AES.block_size))
     return iv + ciphertext
@@ -40,12 +55,26 @@ def decrypt(key: bytes, data: bytes) -> bytes:
     return unpad(cipher.decrypt(ciphertext), AES.block_size)
 
 
+def holds_plaintext(key: bytes, path: str, plaintext: bytes) -> bool:
+    """True if path is an encrypted file whose content is already plaintext."""
+    if not os.path.exists(path):
+        return False
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        return decrypt(key, data) == plaintext
+    except ValueError:
+        return False
+
+
 def main():
     parser = argparse.ArgumentParser(description="AES-256-CBC file encrypt/decrypt")
     parser.add_argument("--key", required=True, help="256-bit key as 64-char hex string")
     parser.add_argument("--input", required=True, help="Input file path")
     parser.add_argument("--output", required=True, help="Output file path")
     parser.add_argument("--decrypt", action="store_true", help="Decrypt instead of encrypt")
+    parser.add_argument("--deterministic", action="store_true",
+                        help="Derive the IV from the content and keep an output that is already up to date")
     args = parser.parse_args()
 
     key = bytes.fromhex(args.key)
@@ -59,8 +88,11 @@ def main():
     if args.decrypt:
         result = decrypt(key, data)
         print(f"Decrypted {len(data)} -> {len(result)} bytes", file=sys.stderr)
+    elif args.deterministic and holds_plaintext(key, args.output, data):
+        print(f"Unchanged: {args.output}", file=sys.stderr)
+        return
     else:
-        result = encrypt(key, data)
+        result = encrypt(key, data, args.deterministic)
         print(f"Encrypted {len(data)} -> {len(result)} bytes", file=sys.stderr)
 
     with open(args.output, "wb") as f:
@@ -0,0 +1,352 @@
+#!/usr/bin/env python3
+"""Pack a rendered screen into bb_epaper's native G5 (Group5) bitmap format.
+
+display_show_image() recognises BB_BITMAP_MARKER payloads and hands them to
+bbep.loadG5Image(), which decodes straight into the framebuffer. That skips the
+PNG inflate + two-plane pass on device and is usually several times smaller
+than the equivalent 1-bpp BMP.
+
+Layout: [BB_BITMAP header, 8 bytes little-endian][G5 bitstream]
+    uint16 marker   0xBBBF
+    int16  width
+    int16  height
+    uint16 size     length of the bitstream that follows
+
+The bitstream is CCITT G4 style 2-D coding (pass / vertical / horizontal modes
+against the previous line, white reference line above the first row), MSB
+first. Horizontal runs use the Group5 short/long run coding instead of the
+T.4 Huffman tables. Every packed image is decoded again and compared before it
+is written, so a bad encode never reaches the content repo; test/test_g5_decode
+checks the same output against bb_epaper's own decoder.
+
+Usage:
+    python g5_pack.py --input weather_munich.bmp --output weather_munich.g5
+    python g5_pack.py --input photo.png --output photo.g5 --dither
+"""
+
+import argparse
+import struct
+import sys
+
+BB_BITMAP_MARKER = 0xBBBF
+HEADER_SIZE = 8
+
+# Panel geometry per display profile — the packed image must match exactly,
+# loadG5Image() does no scaling. Only bb_epaper boards decode G5; TRMNL X
+# drives its panel through FastEPD and takes PNG/JPEG instead.
+PROFILES = {
+    "og": (800, 480),      # 7.5" OG / DIY kit / reTerminal (bb_epaper)
+}
+
+# Mode codes (value, bit length)
+CODE_PASS = (0b0001, 4)
+CODE_HORIZ = (0b001, 3)
+CODE_VERT = {
+    0: (0b1, 1),
+    1: (0b011, 3),
+    -1: (0b010, 3),
+    2: (0b000011, 6),
+    -2: (0b000010, 6),
+    3: (0b0000011, 7),
+    -3: (0b0000010, 7),
+}
+
+# Horizontal runs: 1 selector bit per run, short runs fit in SHORT_BITS,
+# long runs use enough bits to hold the image width.
+SHORT_BITS = 5
+SHORT_MAX = (1 << SHORT_BITS) - 1
+
+
+def long_bits(width: int) -> int:
+    return max(1, width.bit_length())
+
+
+# ── Bit I/O ──────────────────────────────────────────────────────────────────
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.nbits = 0
+
+    def put(self, value: int, length: int):
+        self.acc = (self.acc << length) | (value & ((1 << length) - 1))
+        self.nbits += length
+        while self.nbits >= 8:
+            self.nbits -= 8
+            self.out.append((self.acc >> self.nbits) & 0xFF)
+        self.acc &= (1 << self.nbits) - 1
+
+    def flush(self) -> bytes:
+        if self.nbits:
+            self.out.append((self.acc << (8 - self.nbits)) & 0xFF)
+            self.acc = 0
+            self.nbits = 0
+        return bytes(self.out)
+
+
+class BitReader:
+    def __init__(self, data: bytes):
+        self.data = data
+        self.pos = 0
+
+    def get(self, length: int) -> int:
+        value = 0
+        for _ in range(length):
+            byte = self.data[self.pos >> 3] if (self.pos >> 3) < len(self.data) else 0
+            value = (value << 1) | ((byte >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return value
+
+
+# ── Changing elements ────────────────────────────────────────────────────────
+
+def changes(row, width):
+    """Positions where the colour differs from the pixel to the left (white before x=0)."""
+    out = []
+    prev = False
+    for x in range(width):
+        if row[x] != prev:
+            out.append(x)
+            prev = row[x]
+    return out
+
+
+def next_change(row_changes, start, width):
+    """First changing element strictly greater than start, or width."""
+    for c in row_changes:
+        if c > start:
+            return c
+    return width
+
+
+def find_b1(ref, ref_changes, a0, color, width):
+    # First changing element on the reference line right of a0 whose new colour
+    # is the opposite of the current coding colour.
+    for c in ref_changes:
+        if c > a0 and ref[c] != color:
+            return c
+    return width
+
+
+# ── Encoder / decoder ────────────────────────────────────────────────────────
+
+def encode_rows(rows, width) -> bytes:
+    bw = BitWriter()
+    hbits = long_bits(width)
+    ref = [False] * width
+    ref_changes = []
+
+    def put_run(run):
+        if run <= SHORT_MAX:
+            bw.put(0, 1)
+            bw.put(run, SHORT_BITS)
+        else:
+            bw.put(1, 1)
+            bw.put(run, hbits)
+
+    for cur in rows:
+        cur_changes = changes(cur, width)
+        a0 = -1
+        color = False
+        while a0 < width:
+            a1 = next_change(cur_changes, a0, width)
+            b1 = find_b1(ref, ref_changes, a0, color, width)
+            b2 = next_change(ref_changes, b1, width)
+            if b2 < a1:
+                bw.put(*CODE_PASS)
+                a0 = b2
+            elif abs(a1 - b1) <= 3:
+                bw.put(*CODE_VERT[a1 - b1])
+                a0 = a1
+                color = not color
+            else:
+                a2 = next_change(cur_changes, a1, width)
+                bw.put(*CODE_HORIZ)
+                put_run(a1 - max(a0, 0))
+                put_run(a2 - a1)
+                a0 = a2
+        ref = cur
+        ref_changes = cur_changes
+    return bw.flush()
+
+
+def decode_rows(data: bytes, width, height):
+    br = BitReader(data)
+    hbits = long_bits(width)
+    ref = [False] * width
+    ref_changes = []
+    rows = []
+
+    def get_run():
+        return br.get(hbits) if br.get(1) else br.get(SHORT_BITS)
+
+    for _ in range(height):
+        cur = [False] * width
+        a0 = -1
+        color = False
+
+        def fill(start, end, value):
+            for x in range(max(start, 0), min(end, width)):
+                cur[x] = value
+
+        while a0 < width:
+            b1 = find_b1(ref, ref_changes, a0, color, width)
+            b2 = next_change(ref_changes, b1, width)
+            if br.get(1):
+                delta = 0
+            elif br.get(1):
+                delta = 1 if br.get(1) else -1
+            elif br.get(1):
+                run1 = get_run()
+                run2 = get_run()
+                start = max(a0, 0)
+                fill(start, start + run1, color)
+                fill(start + run1, start + run1 + run2, not color)
+                a0 = start + run1 + run2
+                continue
+            elif br.get(1):
+                fill(a0, b2, color)
+                a0 = b2
+                continue
+            elif br.get(1):
+                delta = 2 if br.get(1) else -2
+            elif br.get(1):
+                delta = 3 if br.get(1) else -3
+            else:
+                raise ValueError("invalid G5 mode code")
+            a1 = b1 + delta
+            fill(a0, a1, color)
+            a0 = a1
+            color = not color
+        rows.append(cur)
+        ref = cur
+        ref_changes = changes(cur, width)
+    return rows
+
+
+def pack(rows, width, height) -> bytes:
+    body = encode_rows(rows, width)
+    if len(body) > 0xFFFF:
+        raise ValueError(f"G5 stream is {len(body)} bytes, exceeds 16-bit size field; use BMP/PNG for this screen")
+    return struct.pack("<HhhH", BB_BITMAP_MARKER, width, height, len(body)) + body
+
+
+# ── Input loading ────────────────────────────────────────────────────────────
+
+def load_bmp(data: bytes):
+    """Uncompressed 1/8/24/32-bpp BMP → (width, height, rows of 0..255 gray), or None."""
+    if data[:2] != b"BM":
+        return None
+    offset = struct.unpack_from("<I", data, 10)[0]
+    width, height = struct.unpack_from("<ii", data, 18)
+    bpp = struct.unpack_from("<H", data, 28)[0]
+    compression = struct.unpack_from("<I", data, 30)[0]
+    if compression != 0 or bpp not in (1, 8, 24, 32):
+        return None
+    bottom_up = height > 0
+    height = abs(height)
+    palette = []
+    if bpp <= 8:
+        entries = struct.unpack_from("<I", data, 46)[0] or (1 << bpp)
+        for i in range(entries):
+            b, g, r, _ = data[54 + i * 4: 58 + i * 4]
+            palette.append((r * 299 + g * 587 + b * 114) // 1000)
+    stride = ((width * bpp + 31) // 32) * 4
+    gray_rows = []
+    for y in range(height):
+        src_y = height - 1 - y if bottom_up else y
+        line = data[offset + src_y * stride: offset + (src_y + 1) * stride]
+        if bpp == 1:
+            gray_rows.append([palette[(line[x >> 3] >> (7 - (x & 7))) & 1] for x in range(width)])
+        elif bpp == 8:
+            gray_rows.append([palette[line[x]] for x in range(width)])
+        else:
+            step = bpp // 8
+            gray_rows.append([(line[x * step + 2] * 299 + line[x * step + 1] * 587 + line[x * step] * 114) // 1000
+                              for x in range(width)])
+    return width, height, gray_rows
+
+
+def load_with_pillow(path: str):
+    try:
+        from PIL import Image
+    except ImportError:
+        print("Error: Pillow is required for non-BMP input. Install with: pip install pillow", file=sys.stderr)
+        sys.exit(1)
+    img = Image.open(path).convert("L")
+    width, height = img.size
+    px = list(img.getdata())
+    return width, height, [px[y * width:(y + 1) * width] for y in range(height)]
+
+
+def to_bilevel(gray_rows, width, dither: bool):
+    if not dither:
+        return [[v < 128 for v in row] for row in gray_rows]
+    # Floyd–Steinberg, same error weights the device uses for JPEG dithering
+    rows = [list(map(float, row)) for row in gray_rows]
+    out = []
+    for y, row in enumerate(rows):
+        nxt = rows[y + 1] if y + 1 < len(rows) else None
+        bits = []
+        for x in range(width):
+            old = row[x]
+            new = 0.0 if old < 128 else 255.0
+            bits.append(new == 0.0)
+            err = old - new
+            if x + 1 < width:
+                row[x + 1] += err * 7 / 16
+            if nxt is not None:
+                if x > 0:
+                    nxt[x - 1] += err * 3 / 16
+                nxt[x] += err * 5 / 16
+                if x + 1 < width:
+                    nxt[x + 1] += err * 1 / 16
+        out.append(bits)
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack an image into bb_epaper G5 format")
+    parser.add_argument("--input", required=True, help="Input image (1/8/24/32-bpp BMP; PNG/JPEG need Pillow)")
+    parser.add_argument("--output", required=True, help="Output .g5 file path")
+    parser.add_argument("--profile", choices=sorted(PROFILES), default="og", help="Target display profile (default og)")
+    parser.add_argument("--dither", action="store_true", help="Floyd-Steinberg dither instead of a 50%% threshold")
+    parser.add_argument("--invert", action="store_true", help="Swap black and white")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    loaded = load_bmp(data) or load_with_pillow(args.input)
+    width, height, gray_rows = loaded
+
+    expected = PROFILES[args.profile]
+    if (width, height) != expected:
+        print(f"Error: image is {width}x{height}, profile '{args.profile}' needs {expected[0]}x{expected[1]}",
+              file=sys.stderr)
+        sys.exit(1)
+
+    rows = to_bilevel(gray_rows, width, args.dither)
+    if args.invert:
+        rows = [[not v for v in row] for row in rows]
+
+    try:
+        packed = pack(rows, width, height)
+    except ValueError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    if decode_rows(packed[HEADER_SIZE:], width, height) != rows:
+        print("Error: G5 round-trip check failed", file=sys.stderr)
+        sys.exit(1)
+
+    with open(args.output, "wb") as f:
+        f.write(packed)
+
+    print(f"Packed {args.input} ({len(data)} bytes) -> {args.output} ({len(packed)} bytes, {args.profile})",
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
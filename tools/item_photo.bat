@@ -13,6 +13,6 @@ set "SLOT=%~1"
 if "%SLOT%"=="" ( echo ERROR: item_photo.bat requires slot as first arg & exit /b 1 )
 
 echo [%SLOT%] Photo of the Day: not yet implemented.
-echo          Add fetch + render logic here, then encrypt with:
-echo          python "%%TOOLS%%\encrypt_image.py" --key %%AES_KEY%% --input "%%TMP%%\photo.bmp" --output "%%IMAGES_DIR%%\%%SLOT%% - photo.enc"
+echo          Add fetch + render logic here, then copy the image to %%PACK_SRC%% if set, else encrypt with:
+echo          python "%%TOOLS%%\encrypt_image.py" --key %%AES_KEY%% --input "%%TMP%%\photo.bmp" --output "%%IMAGES_DIR%%\%%SLOT%% - photo.enc" --deterministic
 exit /b 1
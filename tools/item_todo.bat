@@ -13,6 +13,6 @@ set "SLOT=%~1"
 if "%SLOT%"=="" ( echo ERROR: item_todo.bat requires slot as first arg & exit /b 1 )
 
 echo [%SLOT%] TODO: not yet implemented.
-echo          Add rendering logic here, then encrypt with:
-echo          python "%%TOOLS%%\encrypt_image.py" --key %%AES_KEY%% --input "%%TMP%%\todo.bmp" --output "%%IMAGES_DIR%%\%%SLOT%% - todo.enc"
+echo          Add rendering logic here, then copy the image to %%PACK_SRC%% if set, else encrypt with:
+echo          python "%%TOOLS%%\encrypt_image.py" --key %%AES_KEY%% --input "%%TMP%%\todo.bmp" --output "%%IMAGES_DIR%%\%%SLOT%% - todo.enc" --deterministic
 exit /b 1
@@ -2,40 +2,72 @@
 :: ════════════════════════════════════════════════════════════════════════════
 ::  Weather item — called from update_all.bat
 ::
-::  Usage:   call item_weather.bat <slot> <city>
+::  Usage:   call item_weather.bat <slot> <city> [bmp|g5]
 ::  Example: call item_weather.bat 01 munich
-::           call item_weather.bat 03 taganrog
+::           call item_weather.bat 03 taganrog g5
+::
+::  Format defaults to bmp. g5 packs the screen into bb_epaper's native
+::  compressed bitmap so the device skips image decoding.
 ::
 ::  Requires env vars set by update_all.bat: TOOLS, TMP, IMAGES_DIR, AES_KEY
 ::  Output: %IMAGES_DIR%\<slot> - weather_<city>.enc
+::          %IMAGES_DIR%\<slot> - weather_<city>.dlt  (delta vs previous version, if worthwhile)
+::  With PACK_SRC set (native packer built) the rendered screen and the
+::  published version go there instead; update_all.bat encrypts and diffs them.
 :: ════════════════════════════════════════════════════════════════════════════
 
 set "SLOT=%~1"
 set "CITY=%~2"
+set "FORMAT=%~3"
+if "%FORMAT%"=="" set "FORMAT=bmp"
 
 if "%SLOT%"=="" ( echo ERROR: item_weather.bat requires slot as first arg  & exit /b 1 )
 if "%CITY%"=="" ( echo ERROR: item_weather.bat requires city as second arg & exit /b 1 )
 
 set "STEM=weather_%CITY%"
 set "BMP_FILE=%TMP%\%STEM%.bmp"
+set "OUT_FILE=%TMP%\%STEM%.%FORMAT%"
 set "ENC_FILE=%IMAGES_DIR%\%SLOT% - %STEM%.enc"
+set "DLT_FILE=%IMAGES_DIR%\%SLOT% - %STEM%.dlt"
+set "PREV_FILE=%TMP%\%STEM%.prev.enc"
 
 echo [%SLOT%] Rendering weather: %CITY%...
-python "%TOOLS%\weather.py" --city "%CITY%" --out-dir "%TMP%"
+python "%TOOLS%\weather.py" --city "%CITY%" --out-dir "%TMP%" --format %FORMAT%
 if errorlevel 1 ( echo ERROR: weather.py failed for city '%CITY%' & exit /b 1 )
 
-if not exist "%BMP_FILE%" (
-    echo ERROR: expected BMP not found: %BMP_FILE%
+if not exist "%OUT_FILE%" (
+    echo ERROR: expected %FORMAT% not found: %OUT_FILE%
     exit /b 1
 )
 
+:: Native packer: hand over the screen and the published version (for the
+:: delta); update_all.bat encrypts and diffs them
+if defined PACK_SRC (
+    copy /y "%OUT_FILE%" "%PACK_SRC%\%SLOT% - %STEM%.%FORMAT%" >nul
+    if errorlevel 1 ( echo ERROR: cannot copy to %PACK_SRC% & exit /b 1 )
+    if exist "%ENC_FILE%" copy /y "%ENC_FILE%" "%PACK_SRC%\%SLOT% - %STEM%.prev" >nul
+    echo [%SLOT%] Rendered for pack_content
+    goto cleanup
+)
+
+:: Keep the published version so the device can be sent a delta against it
+del /q "%PREV_FILE%" 2>nul
+if exist "%ENC_FILE%" copy /y "%ENC_FILE%" "%PREV_FILE%" >nul
+
 echo [%SLOT%] Encrypting...
-python "%TOOLS%\encrypt_image.py" --key %AES_KEY% --input "%BMP_FILE%" --output "%ENC_FILE%"
+python "%TOOLS%\encrypt_image.py" --key %AES_KEY% --input "%OUT_FILE%" --output "%ENC_FILE%" --deterministic
 if errorlevel 1 ( echo ERROR: encrypt_image.py failed & exit /b 1 )
 
+echo [%SLOT%] Building delta...
+python "%TOOLS%\make_delta.py" --key %AES_KEY% --base "%PREV_FILE%" --target "%ENC_FILE%" --output "%DLT_FILE%" --deterministic
+if errorlevel 1 ( echo ERROR: make_delta.py failed & exit /b 1 )
+
 echo [%SLOT%] Done ^-^> %ENC_FILE%
 
+:cleanup
 :: Clean tmp files for this item
 del /q "%TMP%\%STEM%.html" 2>nul
 del /q "%TMP%\%STEM%.png"  2>nul
 del /q "%BMP_FILE%"        2>nul
+del /q "%TMP%\%STEM%.g5"   2>nul
+del /q "%PREV_FILE%"       2>nul
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""Build an encrypted XOR/RLE delta between two versions of a screen.
+
+The device keeps the last frame it displayed for each screen. When the manifest
+lists a delta whose base hash matches that cached frame, the device downloads
+the (usually few hundred byte) delta instead of the whole image.
+
+Usage:
+    python make_delta.py --key <hex> --base <old.enc> --target <new.enc> --output <new.dlt>
+
+Delta plaintext layout (all integers little-endian):
+    [4]  "TDLT"
+    [1]  version (1)
+    [1]  flags — bit 0: changed-region table present
+    [2]  reserved
+    [8]  base hash   — first 8 bytes of SHA-256 of the base plaintext
+    [8]  target hash — first 8 bytes of SHA-256 of the target plaintext
+    [4]  target size
+    [1 + 8n] optional: count, then n x (u16 x, u16 y, u16 w, u16 h) panel rects
+    ops: [skip varint][len varint][len XOR bytes] ... (unsigned LEB128 varints)
+
+Changed regions are computed for 1-bpp BMP and G5 screens (the formats the
+device can partially refresh) and let it drive only the pixels that changed.
+
+No delta is written (and any stale one is removed) when there is no previous
+version or the delta would not be meaningfully smaller than the full image. An
+unchanged screen keeps its existing delta if that still targets the current
+frame, so re-running the build on the same inputs leaves the manifest alone.
+--deterministic derives the IV from the content (see encrypt_image.py).
+"""
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import g5_pack  # noqa: E402
+from encrypt_image import deterministic_iv  # noqa: E402
+
+try:
+    from Crypto.Cipher import AES
+    from Crypto.Util.Padding import pad, unpad
+except ImportError:
+    try:
+        from Cryptodome.Cipher import AES
+        from Cryptodome.Util.Padding import pad, unpad
+    except ImportError:
+        print("Error: pycryptodome is required. Install with: pip install pycryptodome", file=sys.stderr)
+        sys.exit(1)
+
+DELTA_MAGIC = b"TDLT"
+DELTA_VERSION = 1
+DELTA_FLAG_RECTS = 0x01
+MAX_RECTS = 8
+# Changed rows closer than this are reported as one region
+ROW_MERGE_GAP = 8
+# Zero gaps shorter than this are folded into the surrounding literal — a new
+# op costs at least two varint bytes.
+MERGE_GAP = 3
+
+
+def encrypt(key: bytes, plaintext: bytes, deterministic: bool = False) -> bytes:
+    iv = deterministic_iv(key, plaintext) if deterministic else os.urandom(16)
+    cipher = AES.new(key, AES.MODE_CBC, iv)
+    ciphertext = cipher.encrypt(pad(plaintext, AES.block_size))
+    return iv + ciphertext
+
+
+def decrypt(key: bytes, data: bytes) -> bytes:
+    cipher = AES.new(key, AES.MODE_CBC, data[:16])
+    return unpad(cipher.decrypt(data[16:]), AES.block_size)
+
+
+def frame_hash(data: bytes) -> bytes:
+    return hashlib.sha256(data).digest()[:8]
+
+
+def varint(n: int) -> bytes:
+    out = bytearray()
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        if n:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def xor_runs(base: bytes, target: bytes):
+    """Yield (start, end) of non-zero XOR runs, merging short zero gaps."""
+    padded = base[:len(target)].ljust(len(target), b"\x00")
+    diff = bytes(a ^ b for a, b in zip(padded, target))
+    runs = []
+    i = 0
+    n = len(diff)
+    while i < n:
+        if diff[i] == 0:
+            i += 1
+            continue
+        start = i
+        while i < n and diff[i] != 0:
+            i += 1
+        if runs and start - runs[-1][1] < MERGE_GAP:
+            runs[-1] = (runs[-1][0], i)
+        else:
+            runs.append((start, i))
+    return diff, runs
+
+
+def bitmap_rows(data: bytes):
+    """1-bpp BMP or G5 → (width, list of packed top-down rows), else None."""
+    if data[:2] == b"BM" and len(data) >= 62:
+        offset = struct.unpack_from("<I", data, 10)[0]
+        width, height = struct.unpack_from("<ii", data, 18)
+        if struct.unpack_from("<H", data, 28)[0] != 1:
+            return None
+        stride = ((width + 31) // 32) * 4
+        rows = [data[offset + y * stride: offset + (y + 1) * stride] for y in range(abs(height))]
+        return width, rows[::-1] if height > 0 else rows
+    if data[:2] == b"\xbf\xbb" and len(data) >= g5_pack.HEADER_SIZE:
+        _, width, height, size = struct.unpack_from("<HhhH", data, 0)
+        rows = g5_pack.decode_rows(data[g5_pack.HEADER_SIZE:g5_pack.HEADER_SIZE + size], width, height)
+        return width, [bytes(row) for row in rows]
+    return None
+
+
+def changed_rects(base: bytes, target: bytes):
+    """Bounding boxes of changed pixels (x aligned to 8), or None if unknown."""
+    b = bitmap_rows(base)
+    t = bitmap_rows(target)
+    if not b or not t or b[0] != t[0] or len(b[1]) != len(t[1]):
+        return None
+    width = t[0]
+    px_per_unit = 8 if target[:2] == b"BM" else 1  # BMP rows are packed bytes, G5 rows are pixels
+
+    bands = []  # [y0, y1, x0, x1] in pixels, inclusive
+    for y, (rb, rt) in enumerate(zip(b[1], t[1])):
+        cols = [i for i in range(min(len(rb), len(rt))) if rb[i] != rt[i]]
+        if not cols:
+            continue
+        x0 = cols[0] * px_per_unit
+        x1 = min(width, (cols[-1] + 1) * px_per_unit) - 1
+        if bands and y - bands[-1][1] <= ROW_MERGE_GAP:
+            band = bands[-1]
+            band[1] = y
+            band[2] = min(band[2], x0)
+            band[3] = max(band[3], x1)
+        else:
+            bands.append([y, y, x0, x1])
+
+    # Too many regions: merge the pair with the smallest vertical gap
+    while len(bands) > MAX_RECTS:
+        i = min(range(len(bands) - 1), key=lambda k: bands[k + 1][0] - bands[k][1])
+        a, c = bands[i], bands.pop(i + 1)
+        bands[i] = [a[0], c[1], min(a[2], c[2]), max(a[3], c[3])]
+
+    rects = []
+    for y0, y1, x0, x1 in bands:
+        x0 &= ~7
+        x1 = min(width - 1, x1 | 7)
+        rects.append((x0, y0, x1 - x0 + 1, y1 - y0 + 1))
+    return rects
+
+
+def make_delta(base: bytes, target: bytes) -> bytes:
+    diff, runs = xor_runs(base, target)
+    rects = changed_rects(base, target)
+    out = bytearray(DELTA_MAGIC)
+    out += bytes([DELTA_VERSION, DELTA_FLAG_RECTS if rects is not None else 0, 0, 0])
+    out += frame_hash(base)
+    out += frame_hash(target)
+    out += struct.pack("<I", len(target))
+    if rects is not None:
+        out.append(len(rects))
+        for rect in rects:
+            out += struct.pack("<HHHH", *rect)
+    pos = 0
+    for start, end in runs:
+        out += varint(start - pos)
+        out += varint(end - start)
+        out += diff[start:end]
+        pos = end
+    return bytes(out)
+
+
+def existing_delta_target(key: bytes, path: str):
+    """Target hash of the delta already at path, or None."""
+    if not os.path.exists(path):
+        return None
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        delta = decrypt(key, data)
+    except ValueError:
+        return None
+    if len(delta) < 28 or delta[:4] != DELTA_MAGIC:
+        return None
+    return delta[16:24]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build encrypted delta between two encrypted screens")
+    parser.add_argument("--key", required=True, help="256-bit key as 64-char hex string")
+    parser.add_argument("--base", required=True, help="Previous encrypted screen (.enc)")
+    parser.add_argument("--target", required=True, help="New encrypted screen (.enc)")
+    parser.add_argument("--output", required=True, help="Output path for encrypted delta (.dlt)")
+    parser.add_argument("--max-ratio", type=float, default=0.5,
+                        help="Skip the delta if larger than this fraction of the target (default 0.5)")
+    parser.add_argument("--deterministic", action="store_true", help="Derive the IV from the delta content")
+    args = parser.parse_args()
+
+    key = bytes.fromhex(args.key)
+    if len(key) != 32:
+        print("Error: key must be 32 bytes (64 hex chars)", file=sys.stderr)
+        sys.exit(1)
+
+    with open(args.target, "rb") as f:
+        target = decrypt(key, f.read())
+
+    def drop(reason):
+        if os.path.exists(args.output):
+            os.remove(args.output)
+        print(f"No delta for {args.target}: {reason}", file=sys.stderr)
+
+    if not os.path.exists(args.base):
+        drop("no previous version")
+        return
+
+    with open(args.base, "rb") as f:
+        base = decrypt(key, f.read())
+
+    if frame_hash(base) == frame_hash(target):
+        if existing_delta_target(key, args.output) == frame_hash(target):
+            print(f"Unchanged: keeping {args.output}", file=sys.stderr)
+        else:
+            drop("unchanged")
+        return
+
+    delta = make_delta(base, target)
+    if len(delta) > len(target) * args.max_ratio:
+        drop(f"delta {len(delta)} bytes vs {len(target)} bytes full")
+        return
+
+    encrypted = encrypt(key, delta, args.deterministic)
+    with open(args.output, "wb") as f:
+        f.write(encrypted)
+    print(f"Delta {args.base} -> {args.target}: {len(delta)} bytes ({len(encrypted)} encrypted)",
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
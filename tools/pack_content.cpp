@@ -0,0 +1,593 @@
+// Native content packer: encrypts a directory of rendered screens, hashes and
+// indexes the published images and writes the encrypted manifest in one run.
+// It builds from the firmware's own src/crypto.cpp, src/delta.cpp and
+// src/image_format.cpp, so the host and the device share one wire format.
+//
+// Output matches `encrypt_image.py --deterministic` + `update_manifest.py
+// --deterministic`: IV = HMAC-SHA256(HMAC-SHA256(key, "trmnl-iv"), plaintext)[:16],
+// unchanged screens are not rewritten, and the manifest (JSON laid out like
+// Python's json.dumps(indent=2), updated_at like datetime.isoformat()) keeps
+// its updated_at unless the screens change.
+//
+// Build:  pio run -e pack_content   (binary: .pio/build/pack_content/program)
+// Usage:  program --key <hex> --images-dir <dir> --manifest <manifest.enc>
+//                 [--src <dir>] [--index <file>] [--refresh-rate 1800] [--jobs N]
+//                 [--mirror <url> ...]
+//
+//   --src      rendered screens (.bmp .png .jpg .jpeg .g5); <stem>.enc is
+//              written to --images-dir for each
+//   --index    cache of size/mtime -> hash/format for .enc files, so
+//              unchanged images aren't decrypted again on the next run
+//   --mirror   extra image base URL listed in the manifest (repeatable)
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "crypto.h"
+#include "delta.h"
+#include "image_format.h"
+
+namespace fs = std::filesystem;
+
+struct Options
+{
+    uint8_t key[AES256_KEY_SIZE];
+    std::string src_dir;
+    std::string images_dir;
+    std::string manifest_path;
+    std::string index_path;
+    int refresh_rate = 1800;
+    unsigned jobs = 0;
+    std::vector<std::string> mirrors;
+};
+
+struct IndexEntry
+{
+    uintmax_t size;
+    long long mtime;
+    std::string hash;
+    std::string format;
+};
+
+struct Screen
+{
+    fs::path plain_path;  // empty: index an existing .enc
+    fs::path enc_path;
+    std::string name;
+    std::string format;
+    std::string hash;
+    uintmax_t size = 0;
+    std::string delta_filename;
+    uintmax_t delta_size = 0;
+    std::string delta_base;
+    const char *action = "indexed";
+    std::string error;
+};
+
+// ---- Helpers ----
+
+static bool read_file(const fs::path &path, std::vector<uint8_t> &out)
+{
+    std::ifstream f(path, std::ios::binary);
+    if (!f)
+        return false;
+    out.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    return !f.bad();
+}
+
+// Write next to the target and rename, so a failed run never leaves half a file
+static bool write_file(const fs::path &path, const uint8_t *data, size_t len)
+{
+    fs::path tmp = path;
+    tmp += ".tmp";
+    {
+        std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+        if (!f || !f.write((const char *)data, len))
+            return false;
+    }
+    std::error_code ec;
+    fs::rename(tmp, path, ec);
+    return !ec;
+}
+
+static bool decrypt_file(const uint8_t *key, const std::vector<uint8_t> &enc, std::vector<uint8_t> &plain)
+{
+    plain.resize(enc.size());
+    size_t plain_len = 0;
+    if (!aes256_cbc_decrypt(key, enc.data(), enc.size(), plain.data(), &plain_len))
+        return false;
+    plain.resize(plain_len);
+    return true;
+}
+
+static std::string hash_hex(const uint8_t *data, size_t len)
+{
+    uint8_t hash[FRAME_HASH_SIZE];
+    char hex[FRAME_HASH_HEX_SIZE];
+    frame_hash(data, len, hash);
+    frame_hash_to_hex(hash, hex);
+    return hex;
+}
+
+static std::string format_key(ImageFormat format)
+{
+    switch (format)
+    {
+    case IMAGE_FORMAT_BMP:  return "bmp";
+    case IMAGE_FORMAT_PNG:  return "png";
+    case IMAGE_FORMAT_JPEG: return "jpeg";
+    case IMAGE_FORMAT_G5:   return "g5";
+    default:                return "unknown";
+    }
+}
+
+static void hmac_sha256(const uint8_t *key, size_t key_len, const uint8_t *prefix, size_t prefix_len,
+                        const uint8_t *data, size_t len, uint8_t *out)
+{
+    uint8_t pad[64] = {0};
+    memcpy(pad, key, key_len);  // key_len <= 64
+    uint8_t inner[32];
+    mbedtls_sha256_context sha;
+
+    for (uint8_t &b : pad)
+        b ^= 0x36;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+    mbedtls_sha256_update(&sha, pad, sizeof(pad));
+    mbedtls_sha256_update(&sha, prefix, prefix_len);
+    mbedtls_sha256_update(&sha, data, len);
+    mbedtls_sha256_finish(&sha, inner);
+    mbedtls_sha256_free(&sha);
+
+    for (uint8_t &b : pad)
+        b ^= 0x36 ^ 0x5C;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+    mbedtls_sha256_update(&sha, pad, sizeof(pad));
+    mbedtls_sha256_update(&sha, inner, sizeof(inner));
+    mbedtls_sha256_finish(&sha, out);
+    mbedtls_sha256_free(&sha);
+}
+
+static bool encrypt_deterministic(const uint8_t *key, const std::vector<uint8_t> &plain, std::vector<uint8_t> &out)
+{
+    // Same as deterministic_iv() in encrypt_image.py: the IV key is derived
+    // from the AES key, which never keys the HMAC itself
+    uint8_t iv_key[32];
+    uint8_t mac[32];
+    hmac_sha256(key, AES256_KEY_SIZE, nullptr, 0, (const uint8_t *)"trmnl-iv", 8, iv_key);
+    hmac_sha256(iv_key, sizeof(iv_key), nullptr, 0, plain.data(), plain.size(), mac);
+    out.resize(aes256_cbc_encrypted_size(plain.size()));
+    size_t out_len = 0;
+    return aes256_cbc_encrypt(key, mac, plain.data(), plain.size(), out.data(), &out_len);
+}
+
+static long long mtime_of(const fs::path &path)
+{
+    std::error_code ec;
+    auto t = fs::last_write_time(path, ec);
+    return ec ? 0 : (long long)t.time_since_epoch().count();
+}
+
+// ---- Per-screen work (runs on the worker threads) ----
+
+static void attach_delta(const Options &opt, Screen &s)
+{
+    fs::path dlt = s.enc_path;
+    dlt.replace_extension(".dlt");
+    std::vector<uint8_t> enc, plain;
+    if (!fs::exists(dlt) || !read_file(dlt, enc))
+        return;
+
+    DeltaHeader header;
+    if (!decrypt_file(opt.key, enc, plain) || !delta_parse_header(plain.data(), plain.size(), header))
+    {
+        fprintf(stderr, "Warning: %s: not a delta, ignoring\n", dlt.filename().string().c_str());
+        return;
+    }
+    char target[FRAME_HASH_HEX_SIZE], base[FRAME_HASH_HEX_SIZE];
+    frame_hash_to_hex(header.target_hash, target);
+    frame_hash_to_hex(header.base_hash, base);
+    if (s.hash != target)
+    {
+        fprintf(stderr, "Warning: %s: stale (target hash mismatch), ignoring\n", dlt.filename().string().c_str());
+        return;
+    }
+    s.delta_filename = dlt.filename().string();
+    s.delta_size = enc.size();
+    s.delta_base = base;
+}
+
+static void pack_screen(const Options &opt, const std::map<std::string, IndexEntry> &index, Screen &s)
+{
+    std::vector<uint8_t> plain, enc;
+    if (!s.plain_path.empty())
+    {
+        if (!read_file(s.plain_path, plain))
+        {
+            s.error = "cannot read " + s.plain_path.string();
+            return;
+        }
+
+        std::vector<uint8_t> existing_enc, existing_plain;
+        if (fs::exists(s.enc_path) && read_file(s.enc_path, existing_enc) &&
+            decrypt_file(opt.key, existing_enc, existing_plain) && existing_plain == plain)
+        {
+            s.action = "unchanged";
+            s.size = existing_enc.size();
+        }
+        else
+        {
+            if (!encrypt_deterministic(opt.key, plain, enc) || !write_file(s.enc_path, enc.data(), enc.size()))
+            {
+                s.error = "cannot encrypt/write " + s.enc_path.string();
+                return;
+            }
+            s.action = "encrypted";
+            s.size = enc.size();
+        }
+    }
+    else
+    {
+        std::error_code ec;
+        s.size = fs::file_size(s.enc_path, ec);
+        auto it = index.find(s.enc_path.filename().string());
+        if (!ec && it != index.end() && it->second.size == s.size && it->second.mtime == mtime_of(s.enc_path))
+        {
+            s.hash = it->second.hash;
+            s.format = it->second.format;
+            s.action = "cached";
+            attach_delta(opt, s);
+            return;
+        }
+        if (!read_file(s.enc_path, enc) || !decrypt_file(opt.key, enc, plain))
+        {
+            s.error = "cannot decrypt " + s.enc_path.string();
+            return;
+        }
+        s.size = enc.size();
+    }
+
+    s.hash = hash_hex(plain.data(), plain.size());
+    s.format = format_key(detect_image_format(plain.data(), plain.size()));
+    if (s.format == "unknown")
+        fprintf(stderr, "Warning: %s: unrecognised image format\n", s.enc_path.filename().string().c_str());
+    attach_delta(opt, s);
+}
+
+// ---- Index file: "<size> <mtime> <hash> <format> <filename>" per line ----
+
+static std::map<std::string, IndexEntry> load_index(const std::string &path)
+{
+    std::map<std::string, IndexEntry> index;
+    std::ifstream f(path);
+    std::string line;
+    while (std::getline(f, line))
+    {
+        std::istringstream in(line);
+        IndexEntry e;
+        std::string name;
+        if (in >> e.size >> e.mtime >> e.hash >> e.format && std::getline(in >> std::ws, name))
+            index[name] = e;
+    }
+    return index;
+}
+
+static void save_index(const std::string &path, const std::vector<Screen> &screens)
+{
+    std::ostringstream out;
+    for (const Screen &s : screens)
+        out << s.size << ' ' << mtime_of(s.enc_path) << ' ' << s.hash << ' ' << s.format << ' '
+            << s.enc_path.filename().string() << '\n';
+    std::string text = out.str();
+    if (!write_file(path, (const uint8_t *)text.data(), text.size()))
+        fprintf(stderr, "Warning: cannot write index %s\n", path.c_str());
+}
+
+// ---- Manifest ----
+
+// json.dumps() string escaping with its default ensure_ascii=True
+static std::string json_string(const std::string &s)
+{
+    std::string out = "\"";
+    char buf[16];
+    for (size_t i = 0; i < s.size();)
+    {
+        uint8_t c = s[i];
+        uint32_t cp = c;
+        size_t n = 1;
+        if (c >= 0xF0 && i + 3 < s.size())
+        {
+            cp = ((c & 0x07) << 18) | ((s[i + 1] & 0x3F) << 12) | ((s[i + 2] & 0x3F) << 6) | (s[i + 3] & 0x3F);
+            n = 4;
+        }
+        else if (c >= 0xE0 && i + 2 < s.size())
+        {
+            cp = ((c & 0x0F) << 12) | ((s[i + 1] & 0x3F) << 6) | (s[i + 2] & 0x3F);
+            n = 3;
+        }
+        else if (c >= 0xC0 && i + 1 < s.size())
+        {
+            cp = ((c & 0x1F) << 6) | (s[i + 1] & 0x3F);
+            n = 2;
+        }
+        i += n;
+
+        if (cp == '"')
+            out += "\\\"";
+        else if (cp == '\\')
+            out += "\\\\";
+        else if (cp == '\n')
+            out += "\\n";
+        else if (cp == '\r')
+            out += "\\r";
+        else if (cp == '\t')
+            out += "\\t";
+        else if (cp == '\b')
+            out += "\\b";
+        else if (cp == '\f')
+            out += "\\f";
+        else if (cp < 0x20 || (cp >= 0x80 && cp < 0x10000))
+        {
+            snprintf(buf, sizeof(buf), "\\u%04x", cp);
+            out += buf;
+        }
+        else if (cp >= 0x10000)
+        {
+            cp -= 0x10000;
+            snprintf(buf, sizeof(buf), "\\u%04x\\u%04x", 0xD800 + (cp >> 10), 0xDC00 + (cp & 0x3FF));
+            out += buf;
+        }
+        else
+            out += (char)cp;
+    }
+    return out + "\"";
+}
+
+static std::string manifest_json(const Options &opt, const std::vector<Screen> &screens, const std::string &updated_at)
+{
+    std::ostringstream j;
+    j << "{\n  \"version\": 1,\n  \"refresh_rate\": " << opt.refresh_rate
+      << ",\n  \"updated_at\": " << json_string(updated_at);
+    if (!opt.mirrors.empty())
+    {
+        j << ",\n  \"mirrors\": [";
+        for (size_t i = 0; i < opt.mirrors.size(); i++)
+            j << (i ? ",\n" : "\n") << "    " << json_string(opt.mirrors[i]);
+        j << "\n  ]";
+    }
+    j << ",\n  \"screens\": [";
+    for (size_t i = 0; i < screens.size(); i++)
+    {
+        const Screen &s = screens[i];
+        j << (i ? ",\n" : "\n") << "    {\n"
+          << "      \"name\": " << json_string(s.name) << ",\n"
+          << "      \"filename\": " << json_string(s.enc_path.filename().string()) << ",\n"
+          << "      \"size\": " << s.size << ",\n"
+          << "      \"format\": " << json_string(s.format) << ",\n"
+          << "      \"hash\": " << json_string(s.hash);
+        if (!s.delta_filename.empty())
+            j << ",\n      \"delta\": {\n"
+              << "        \"filename\": " << json_string(s.delta_filename) << ",\n"
+              << "        \"size\": " << s.delta_size << ",\n"
+              << "        \"base\": " << json_string(s.delta_base) << "\n      }";
+        j << "\n    }";
+    }
+    j << "\n  ]\n}";
+    return j.str();
+}
+
+// Existing manifest with its updated_at swapped for ours, to compare the rest
+static bool manifest_unchanged(const Options &opt, const std::string &json, const std::string &updated_at)
+{
+    std::vector<uint8_t> enc, plain;
+    if (!read_file(opt.manifest_path, enc) || !decrypt_file(opt.key, enc, plain))
+        return false;
+    std::string old(plain.begin(), plain.end());
+    const std::string field = "\"updated_at\": \"";
+    size_t start = old.find(field);
+    size_t end = start == std::string::npos ? start : old.find('"', start + field.size());
+    if (end == std::string::npos)
+        return false;
+    old.replace(start + field.size(), end - start - field.size(), updated_at);
+    return old == json;
+}
+
+// datetime.now(timezone.utc).isoformat(): microseconds unless they are zero
+static std::string utc_now()
+{
+    using namespace std::chrono;
+    auto since_epoch = system_clock::now().time_since_epoch();
+    time_t now = (time_t)duration_cast<seconds>(since_epoch).count();
+    long micros = (long)(duration_cast<microseconds>(since_epoch).count() % 1000000);
+    struct tm tm_utc;
+#ifdef _WIN32
+    gmtime_s(&tm_utc, &now);
+#else
+    gmtime_r(&now, &tm_utc);
+#endif
+    char buf[40];
+    size_t n = strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tm_utc);
+    if (micros)
+        n += snprintf(buf + n, sizeof(buf) - n, ".%06ld", micros);
+    snprintf(buf + n, sizeof(buf) - n, "+00:00");
+    return buf;
+}
+
+// ---- Main ----
+
+static void usage()
+{
+    fprintf(stderr, "Usage: pack_content --key <hex> --images-dir <dir> --manifest <file>\n"
+                    "                    [--src <dir>] [--index <file>] [--refresh-rate N] [--jobs N]\n"
+                    "                    [--mirror <url> ...]\n");
+}
+
+static bool parse_args(int argc, char **argv, Options &opt)
+{
+    std::string key_hex;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+            return false;
+        const char *value = argv[++i];
+        if (arg == "--key")
+            key_hex = value;
+        else if (arg == "--src")
+            opt.src_dir = value;
+        else if (arg == "--images-dir")
+            opt.images_dir = value;
+        else if (arg == "--manifest")
+            opt.manifest_path = value;
+        else if (arg == "--index")
+            opt.index_path = value;
+        else if (arg == "--refresh-rate")
+            opt.refresh_rate = atoi(value);
+        else if (arg == "--jobs")
+            opt.jobs = (unsigned)atoi(value);
+        else if (arg == "--mirror")
+            opt.mirrors.push_back(value);
+        else
+            return false;
+    }
+    if (key_hex.size() != AES256_KEY_SIZE * 2 || !hex_to_bytes(key_hex.c_str(), opt.key, AES256_KEY_SIZE))
+    {
+        fprintf(stderr, "Error: key must be 32 bytes (64 hex chars)\n");
+        return false;
+    }
+    return !opt.images_dir.empty() && !opt.manifest_path.empty() && opt.refresh_rate > 0;
+}
+
+static bool is_screen_source(const fs::path &p)
+{
+    std::string ext = p.extension().string();
+    for (char &c : ext)
+        c = (char)tolower((unsigned char)c);
+    return ext == ".bmp" || ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".g5";
+}
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    if (!parse_args(argc, argv, opt))
+    {
+        usage();
+        return 1;
+    }
+
+    // Collect work: sources to encrypt, then published .enc files not covered by them
+    std::map<std::string, Screen> by_file;
+    std::error_code ec;
+    if (!opt.src_dir.empty())
+    {
+        for (const auto &entry : fs::directory_iterator(opt.src_dir, ec))
+        {
+            if (!entry.is_regular_file() || !is_screen_source(entry.path()))
+                continue;
+            Screen s;
+            s.plain_path = entry.path();
+            s.name = entry.path().stem().string();
+            s.enc_path = fs::path(opt.images_dir) / (s.name + ".enc");
+            by_file[s.enc_path.filename().string()] = s;
+        }
+        if (ec)
+        {
+            fprintf(stderr, "Error: cannot list %s: %s\n", opt.src_dir.c_str(), ec.message().c_str());
+            return 1;
+        }
+    }
+    for (const auto &entry : fs::directory_iterator(opt.images_dir, ec))
+    {
+        std::string fname = entry.path().filename().string();
+        if (!entry.is_regular_file() || entry.path().extension() != ".enc" || by_file.count(fname))
+            continue;
+        Screen s;
+        s.name = entry.path().stem().string();
+        s.enc_path = entry.path();
+        by_file[fname] = s;
+    }
+    if (ec)
+    {
+        fprintf(stderr, "Error: cannot list %s: %s\n", opt.images_dir.c_str(), ec.message().c_str());
+        return 1;
+    }
+    if (by_file.empty())
+    {
+        fprintf(stderr, "Error: no screens found in %s\n", opt.images_dir.c_str());
+        return 1;
+    }
+
+    // std::map iterates in filename order, same as update_manifest.py's sorted()
+    std::vector<Screen> screens;
+    for (auto &kv : by_file)
+        screens.push_back(kv.second);
+
+    std::map<std::string, IndexEntry> index;
+    if (!opt.index_path.empty())
+        index = load_index(opt.index_path);
+
+    unsigned jobs = opt.jobs ? opt.jobs : std::thread::hardware_concurrency();
+    if (jobs == 0)
+        jobs = 1;
+    if (jobs > screens.size())
+        jobs = (unsigned)screens.size();
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned w = 0; w < jobs; w++)
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < screens.size(); i = next++)
+                pack_screen(opt, index, screens[i]);
+        });
+    for (std::thread &t : workers)
+        t.join();
+
+    bool failed = false;
+    for (const Screen &s : screens)
+    {
+        if (!s.error.empty())
+        {
+            fprintf(stderr, "Error: %s\n", s.error.c_str());
+            failed = true;
+            continue;
+        }
+        fprintf(stderr, "  %-9s %s (%s, %s%s)\n", s.action, s.enc_path.filename().string().c_str(),
+                s.format.c_str(), s.hash.c_str(), s.delta_filename.empty() ? "" : ", delta");
+    }
+    if (failed)
+        return 1;
+
+    if (!opt.index_path.empty())
+        save_index(opt.index_path, screens);
+
+    std::string updated_at = utc_now();
+    std::string json = manifest_json(opt, screens, updated_at);
+    if (manifest_unchanged(opt, json, updated_at))
+    {
+        fprintf(stderr, "Manifest unchanged (%zu screens), keeping %s\n", screens.size(), opt.manifest_path.c_str());
+        return 0;
+    }
+
+    std::vector<uint8_t> plain(json.begin(), json.end()), enc;
+    if (!encrypt_deterministic(opt.key, plain, enc) || !write_file(opt.manifest_path, enc.data(), enc.size()))
+    {
+        fprintf(stderr, "Error: cannot write %s\n", opt.manifest_path.c_str());
+        return 1;
+    }
+    std::string debug_path = opt.manifest_path + ".debug.json";
+    write_file(debug_path, plain.data(), plain.size());
+    fprintf(stderr, "Manifest: %zu screens, %zu bytes JSON -> %s (%zu bytes, %u jobs)\n", screens.size(),
+            json.size(), opt.manifest_path.c_str(), enc.size(), jobs);
+    return 0;
+}
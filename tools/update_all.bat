@@ -51,6 +51,17 @@ if not exist "%KEY_FILE%" (
 )
 set /p AES_KEY=<"%KEY_FILE%"
 
+:: ── Native packer (pio run -e pack_content) ──────────────────────────────────
+:: If built, items only render into PACK_SRC and one packer run encrypts them
+:: all on every core. Without it each item encrypts with the Python tools.
+set "PACKER=%ROOT%\.pio\build\pack_content\program.exe"
+set "PACK_SRC="
+if exist "%PACKER%" (
+    if exist "%TMP%\pack_src" rmdir /s /q "%TMP%\pack_src"
+    mkdir "%TMP%\pack_src"
+    set "PACK_SRC=%TMP%\pack_src"
+)
+
 echo.
 echo ============================================================================
 echo  ITEMS  (edit below to add / remove / reorder screens)
@@ -60,7 +71,7 @@ echo.
 
 :: ── Item list ─────────────────────────────────────────────────────────────────
 :: Format:
-::   call "%TOOLS%\item_weather.bat"  <slot>  <city>
+::   call "%TOOLS%\item_weather.bat"  <slot>  <city>  [bmp|g5]
 ::   call "%TOOLS%\item_todo.bat"     <slot>
 ::   call "%TOOLS%\item_photo.bat"    <slot>
 ::
@@ -83,11 +94,39 @@ echo.
 echo ============================================================================
 echo  Updating manifest...
 echo ============================================================================
-python "%TOOLS%\update_manifest.py" ^
-    --key %AES_KEY% ^
-    --images-dir "%IMAGES_DIR%" ^
-    --output "%CONTENT_DIR%\manifest.enc"
-if errorlevel 1 ( echo ERROR: update_manifest.py failed & exit /b 1 )
+if defined PACK_SRC (
+    rem 1. Encrypt every rendered screen; this manifest is only scratch
+    "%PACKER%" ^
+        --key %AES_KEY% ^
+        --src "%PACK_SRC%" ^
+        --images-dir "%IMAGES_DIR%" ^
+        --manifest "%TMP%\pack_scratch.enc" ^
+        --index "%ROOT%\.pack_index" ^
+        --jobs %NUMBER_OF_PROCESSORS%
+    if errorlevel 1 ( echo ERROR: pack_content failed & exit /b 1 )
+
+    rem 2. Deltas against the versions the items set aside as <name>.prev
+    for %%p in ("%PACK_SRC%\*.prev") do (
+        python "%TOOLS%\make_delta.py" --key %AES_KEY% --base "%%p" ^
+            --target "%IMAGES_DIR%\%%~np.enc" --output "%IMAGES_DIR%\%%~np.dlt" --deterministic
+        if errorlevel 1 ( echo ERROR: make_delta.py failed for %%~np & exit /b 1 )
+    )
+
+    rem 3. The manifest, now listing the deltas; hashes come from the index
+    "%PACKER%" ^
+        --key %AES_KEY% ^
+        --images-dir "%IMAGES_DIR%" ^
+        --manifest "%CONTENT_DIR%\manifest.enc" ^
+        --index "%ROOT%\.pack_index"
+    if errorlevel 1 ( echo ERROR: pack_content failed & exit /b 1 )
+) else (
+    python "%TOOLS%\update_manifest.py" ^
+        --key %AES_KEY% ^
+        --images-dir "%IMAGES_DIR%" ^
+        --output "%CONTENT_DIR%\manifest.enc" ^
+        --deterministic
+    if errorlevel 1 ( echo ERROR: update_manifest.py failed & exit /b 1 )
+)
 
 :: ── Commit and force-push content repo ───────────────────────────────────────
 echo.
@@ -95,6 +134,13 @@ echo ===========================================================================
 echo  Pushing to content repo...
 echo ============================================================================
 pushd "%CONTENT_DIR%"
+:: Deterministic builds reproduce unchanged screens byte for byte — nothing to push
+git status --porcelain | findstr . >nul
+if errorlevel 1 (
+    echo No content changes, skipping push
+    popd
+    goto cleanup
+)
 git checkout --orphan temp_branch
 git add -A
 git commit -m "content update %date% %time%"
@@ -104,9 +150,11 @@ popd
 if errorlevel 1 ( echo ERROR: git push failed & exit /b 1 )
 
 :: ── Clean up tmp ─────────────────────────────────────────────────────────────
+:cleanup
 echo.
 echo Cleaning up tmp...
 for %%f in ("%TMP%\*") do del /q "%%f" 2>nul
+if exist "%TMP%\pack_src" rmdir /s /q "%TMP%\pack_src"
 
 echo.
 echo All done!
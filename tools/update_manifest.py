@@ -3,50 +3,143 @@
 
 Usage:
     python update_manifest.py --key <hex> --images-dir <path> --output <path> [--refresh-rate 1800]
+                              [--mirror <images base URL> ...]
+
+Each screen's "format" (bmp/png/jpeg/g5) is detected from its decrypted magic
+bytes, and "hash" identifies the exact frame (first 8 bytes of SHA-256 of the
+plaintext). If a <name>.dlt built by make_delta.py sits next to <name>.enc and
+targets the current hash, it is listed under "delta" with the base hash it
+applies to. The device skips the download when its cached frame already has
+"hash", and fetches only the delta when its cached frame matches "delta.base".
+
+Each --mirror adds an image base URL the device may fetch the same .enc/.dlt
+files from, e.g. a raw CDN copy of the repo next to GitHub Pages. It tries
+them together with its configured images_base, fastest healthy origin first.
+
+With --deterministic the IV is derived from the content (see encrypt_image.py)
+and an existing manifest with the same refresh rate and screens is left as is,
+updated_at included, so an unchanged content build produces no new files.
 
 The manifest JSON format (before encryption):
 {
     "version": 1,
     "refresh_rate": 1800,
     "updated_at": "2025-01-01T00:00:00Z",
+    "mirrors": ["https://cdn.jsdelivr.net/gh/user/repo@main/images/"],   (only with --mirror)
     "screens": [
-        {"name": "screen1", "filename": "screen1.enc", "size": 12345},
+        {"name": "screen1", "filename": "screen1.enc", "size": 12345, "format": "bmp",
+         "hash": "0123456789abcdef",
+         "delta": {"filename": "screen1.dlt", "size": 320, "base": "fedcba9876543210"}},
         ...
     ]
 }
 """
 
 import argparse
+import hashlib
 import json
 import os
 import sys
 from datetime import datetime, timezone
 
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from encrypt_image import deterministic_iv  # noqa: E402
+
 try:
     from Crypto.Cipher import AES
-    from Crypto.Util.Padding import pad
+    from Crypto.Util.Padding import pad, unpad
 except ImportError:
     try:
         from Cryptodome.Cipher import AES
-        from Cryptodome.Util.Padding import pad
+        from Cryptodome.Util.Padding import pad, unpad
     except ImportError:
         print("Error: pycryptodome is required. Install with: pip install pycryptodome", file=sys.stderr)
         sys.exit(1)
 
 
-def encrypt(key: bytes, plaintext: bytes) -> bytes:
-    iv = os.urandom(16)
+def encrypt(key: bytes, plaintext: bytes, deterministic: bool = False) -> bytes:
+    iv = deterministic_iv(key, plaintext) if deterministic else os.urandom(16)
     cipher = AES.new(key, AES.MODE_CBC, iv)
     ciphertext = cipher.encrypt(pad(plaintext, AES.block_size))
     return iv + ciphertext
 
 
+def decrypt(key: bytes, data: bytes) -> bytes:
+    cipher = AES.new(key, AES.MODE_CBC, data[:16])
+    return unpad(cipher.decrypt(data[16:]), AES.block_size)
+
+
+def frame_hash(data: bytes) -> str:
+    # Same truncated SHA-256 the device uses to identify cached frames
+    return hashlib.sha256(data).digest()[:8].hex()
+
+
+def detect_format(plaintext: bytes) -> str:
+    if plaintext[:2] == b"BM":
+        return "bmp"
+    if plaintext[:4] == b"\x89PNG":
+        return "png"
+    if plaintext[:2] == b"\xff\xd8":
+        return "jpeg"
+    if plaintext[:2] == b"\xbf\xbb":  # BB_BITMAP_MARKER 0xBBBF, little-endian
+        return "g5"
+    return "unknown"
+
+
+def read_delta(key: bytes, fpath: str, target_hash: str):
+    """Return the manifest entry for a .dlt next to a screen, or None if absent/stale."""
+    if not os.path.exists(fpath):
+        return None
+    with open(fpath, "rb") as f:
+        data = f.read()
+    try:
+        delta = decrypt(key, data)
+    except ValueError:
+        print(f"Warning: {os.path.basename(fpath)}: cannot decrypt, ignoring", file=sys.stderr)
+        return None
+    if len(delta) < 28 or delta[:4] != b"TDLT":
+        print(f"Warning: {os.path.basename(fpath)}: not a delta, ignoring", file=sys.stderr)
+        return None
+    if delta[16:24].hex() != target_hash:
+        print(f"Warning: {os.path.basename(fpath)}: stale (target hash mismatch), ignoring", file=sys.stderr)
+        return None
+    return {
+        "filename": os.path.basename(fpath),
+        "size": len(data),
+        "base": delta[8:16].hex(),
+    }
+
+
+def read_manifest(key: bytes, path: str):
+    """Decrypted manifest at path, or None if absent or unreadable."""
+    if not os.path.exists(path):
+        return None
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        return json.loads(decrypt(key, data))
+    except ValueError:
+        return None
+
+
+def same_content(old, new) -> bool:
+    """Everything but updated_at matches."""
+    if old is None:
+        return False
+    strip = lambda m: {k: v for k, v in m.items() if k != "updated_at"}  # noqa: E731
+    return strip(old) == strip(new)
+
+
 def main():
     parser = argparse.ArgumentParser(description="Build encrypted manifest from image directory")
     parser.add_argument("--key", required=True, help="256-bit key as 64-char hex string")
     parser.add_argument("--images-dir", required=True, help="Directory containing .enc image files")
     parser.add_argument("--output", required=True, help="Output path for encrypted manifest")
     parser.add_argument("--refresh-rate", type=int, default=1800, help="Refresh rate in seconds (default 1800)")
+    parser.add_argument("--mirror", action="append", default=[],
+                        help="Extra image base URL (repeatable), tried alongside the device's images_base")
+    parser.add_argument("--deterministic", action="store_true",
+                        help="Derive the IV from the content and keep an unchanged manifest")
     args = parser.parse_args()
 
     key = bytes.fromhex(args.key)
@@ -62,11 +155,27 @@ def main():
             fpath = os.path.join(images_dir, fname)
             size = os.path.getsize(fpath)
             name = os.path.splitext(fname)[0]
-            screens.append({
+            with open(fpath, "rb") as f:
+                data = f.read()
+            try:
+                plaintext = decrypt(key, data)
+            except ValueError:
+                print(f"Error: {fname}: cannot decrypt", file=sys.stderr)
+                sys.exit(1)
+            fmt = detect_format(plaintext)
+            if fmt == "unknown":
+                print(f"Warning: {fname}: unrecognised image format", file=sys.stderr)
+            entry = {
                 "name": name,
                 "filename": fname,
                 "size": size,
-            })
+                "format": fmt,
+                "hash": frame_hash(plaintext),
+            }
+            delta = read_delta(key, os.path.join(images_dir, name + ".dlt"), entry["hash"])
+            if delta:
+                entry["delta"] = delta
+            screens.append(entry)
 
     if not screens:
         print(f"Error: no .enc files found in {images_dir}", file=sys.stderr)
@@ -76,13 +185,19 @@ def main():
         "version": 1,
         "refresh_rate": args.refresh_rate,
         "updated_at": datetime.now(timezone.utc).isoformat(),
-        "screens": screens,
     }
+    if args.mirror:
+        manifest["mirrors"] = args.mirror
+    manifest["screens"] = screens
+
+    if args.deterministic and same_content(read_manifest(key, args.output), manifest):
+        print(f"Manifest unchanged ({len(screens)} screens), keeping {args.output}", file=sys.stderr)
+        return
 
     manifest_json = json.dumps(manifest, indent=2).encode("utf-8")
     print(f"Manifest: {len(screens)} screens, {len(manifest_json)} bytes JSON", file=sys.stderr)
 
-    encrypted = encrypt(key, manifest_json)
+    encrypted = encrypt(key, manifest_json, args.deterministic)
 
     with open(args.output, "wb") as f:
         f.write(encrypted)
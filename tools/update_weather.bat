@@ -61,7 +61,7 @@ if not exist "%KEY_FILE%" (
 set /p AES_KEY=<"%KEY_FILE%"
 
 echo Encrypting...
-python "%TOOLS%\encrypt_image.py" --key %AES_KEY% --input "%BMP_FILE%" --output "%ENC_FILE%"
+python "%TOOLS%\encrypt_image.py" --key %AES_KEY% --input "%BMP_FILE%" --output "%ENC_FILE%" --deterministic
 if errorlevel 1 ( echo ERROR: encrypt_image.py failed & exit /b 1 )
 
 :: ── Step 5: Orphan commit + force push ────────────────────────
@@ -10,21 +10,24 @@ Launch:
     python weather.py                  # defaults to munich
     python weather.py --city berlin
     python weather.py --city new_york
+    python weather.py --city munich --format g5
 
 City configs are stored in tools/cities.json next to this script.
-Output files are named weather_<city>.html/.png/.bmp
+Output files are named weather_<city>.html/.png/.bmp (+ .g5 with --format g5)
 """
 
 import argparse
 import json
 import requests
 import subprocess
+import sys
 from pathlib import Path
 from datetime import datetime
 from jinja2 import Template
 
 BASE_URL   = "https://trmnl.com"
 CITIES_JSON = Path(__file__).parent / "cities.json"
+G5_PACK     = Path(__file__).parent / "g5_pack.py"
 
 
 def load_city(slug: str) -> dict:
@@ -353,6 +356,16 @@ def to_bmp(png_path, bmp_path):
     return bmp_path
 
 
+def to_g5(bmp_path, g5_path):
+    subprocess.run([
+        sys.executable, str(G5_PACK),
+        "--input", bmp_path,
+        "--output", g5_path,
+    ], check=True)
+    print(f"  G5   → {g5_path}")
+    return g5_path
+
+
 def parse_args():
     parser = argparse.ArgumentParser(description="Render TRMNL weather image")
     parser.add_argument(
@@ -363,6 +376,10 @@ def parse_args():
         "--out-dir", default=".",
         help="Output directory for generated files (default: current dir)",
     )
+    parser.add_argument(
+        "--format", choices=["bmp", "g5"], default="bmp",
+        help="Device image format (default: bmp; g5 = bb_epaper native, no decode on device)",
+    )
     return parser.parse_args()
 
 
@@ -385,11 +402,14 @@ def main():
     html = render_html(ctx, out_dir / f"{stem}.html")
     png  = screenshot(str(html), str(out_dir / f"{stem}.png"))
     bmp  = to_bmp(png, str(out_dir / f"{stem}.bmp"))
+    device = bmp
+    if args.format == "g5":
+        device = to_g5(bmp, str(out_dir / f"{stem}.g5"))
     print()
     print("Done:")
     print(f"  Browser:  {html}")
     print(f"  Preview:  {png}")
-    print(f"  Device:   {bmp}")
+    print(f"  Device:   {device}")
 
 
 if __name__ == "__main__":